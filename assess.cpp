@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <cmath>
+
+#include <boost/filesystem/fstream.hpp>
+
+#include "assess.h"
+
+namespace fs = boost::filesystem;
+
+using namespace std;
+
+
+bool GroundTruth::load(const fs::path &file) {
+
+	fs::ifstream in(file);
+	if (!in)
+		return false;
+
+	string line;
+	while (getline(in, line)) {
+		if (!line.empty() && line.back() == '\r')
+			line.pop_back();
+		if (line.empty() || line[0] == '#')
+			continue;
+
+		size_t sep = line.find_first_of("\t,");
+		if (sep == string::npos)
+			continue;
+
+		add(line.substr(0, sep), line.substr(sep + 1));
+	}
+
+	return true;
+}
+
+void GroundTruth::add(const string &fileName, const string &label) {
+	labelOf[fileName] = ids.emplace(label, ids.size()).first->second;
+}
+
+int GroundTruth::label(const string &fileName) const {
+	auto it = labelOf.find(fileName);
+	return it == labelOf.end() ? -1 : it->second;
+}
+
+
+ClusterScores scoreClusters(const vector<int> &clusterOf, const vector<int> &labelOf) {
+
+	ClusterScores scores;
+	const size_t n = clusterOf.size();
+	if (n == 0)
+		return scores;
+
+	const int clusters = *max_element(clusterOf.begin(), clusterOf.end()) + 1;
+	const int classes  = *max_element(labelOf.begin(), labelOf.end()) + 1;
+
+	// Glyphs grouped by cluster (counting sort), and the class sizes
+	vector<size_t> start(clusters + 1, 0);
+	vector<size_t> members(n);
+	vector<long long> classSize(classes, 0);
+	for (size_t i = 0; i < n; ++i) {
+		++start[clusterOf[i] + 1];
+		++classSize[labelOf[i]];
+	}
+	for (int c = 0; c < clusters; ++c)
+		start[c + 1] += start[c];
+	{
+		vector<size_t> next(start.begin(), start.end() - 1);
+		for (size_t i = 0; i < n; ++i)
+			members[next[clusterOf[i]]++] = i;
+	}
+
+	// Walk the non-empty cells of the contingency table one cluster at a time
+	const double total = n;
+	unsigned long long sameBoth = 0, sameCluster = 0, sameClass = 0;
+	long long majority = 0;
+	double mutualInfo = 0, clusterEntropy = 0, classEntropy = 0;
+
+	vector<long long> cell(classes, 0);
+	vector<int> touched;
+	for (int c = 0; c < clusters; ++c) {
+		const long long size = start[c + 1] - start[c];
+		if (size == 0)
+			continue;
+
+		for (size_t k = start[c]; k < start[c + 1]; ++k) {
+			int label = labelOf[members[k]];
+			if (cell[label]++ == 0)
+				touched.push_back(label);
+		}
+
+		long long largest = 0;
+		for (int label : touched) {
+			const long long nij = cell[label];
+			sameBoth  += nij * (nij - 1);
+			largest    = max(largest, nij);
+			mutualInfo += nij / total * log(total * nij / ((double)size * classSize[label]));
+			cell[label] = 0;
+		}
+		touched.clear();
+
+		majority       += largest;
+		sameCluster    += size * (size - 1);
+		clusterEntropy -= size / total * log(size / total);
+	}
+
+	for (long long size : classSize) {
+		if (size == 0)
+			continue;
+		sameClass    += size * (size - 1);
+		classEntropy -= size / total * log(size / total);
+	}
+
+	const unsigned long long pairs = (unsigned long long)n * (n - 1);
+	scores.e11 = sameBoth;
+	scores.e10 = sameCluster - sameBoth;
+	scores.e01 = sameClass - sameBoth;
+	scores.e00 = pairs - sameCluster - sameClass + sameBoth;
+
+	scores.randIndex = pairs ? (double)(scores.e00 + scores.e11) / pairs : 1.0;
+
+	// Adjusted Rand index, with every term doubled to count ordered pairs
+	const double expected = (double)sameCluster * sameClass / (pairs ? pairs : 1);
+	const double maximum  = (sameCluster + sameClass) / 2.0;
+	scores.adjustedRand = maximum != expected ? (sameBoth - expected) / (maximum - expected) : 1.0;
+
+	scores.purity = majority / total;
+	scores.nmi    = clusterEntropy + classEntropy > 0 ? 2 * mutualInfo / (clusterEntropy + classEntropy) : 1.0;
+
+	return scores;
+}
@@ -0,0 +1,47 @@
+#ifndef ASSESS_H
+#define ASSESS_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+// Reference classes of the glyphs, read at runtime.
+class GroundTruth {
+public:
+	// Reads "<file name><tab or comma><label>" lines, skipping empty ones and
+	// those starting with '#'. False if the file cannot be opened.
+	bool load(const boost::filesystem::path &file);
+
+	// Puts fileName into the class called label
+	void add(const std::string &fileName, const std::string &label);
+
+	size_t size()    const { return labelOf.size(); }
+	int    classes() const { return ids.size(); }
+
+	// Dense id (0 .. classes() - 1) of the class of fileName, or -1
+	int label(const std::string &fileName) const;
+
+private:
+	std::unordered_map<std::string, int> labelOf;
+	std::unordered_map<std::string, int> ids;   // label text -> dense id
+};
+
+struct ClusterScores {
+	// Ordered pairs of distinct glyphs: e<same cluster><same class>, so e10
+	// counts pairs clustered together across classes and e01 pairs of one
+	// class that were split
+	unsigned long long e00 = 0, e01 = 0, e10 = 0, e11 = 0;
+
+	double randIndex    = 0;
+	double adjustedRand = 0;
+	double purity       = 0;
+	double nmi          = 0;   // normalized by the arithmetic mean of entropies
+};
+
+// Compares a clustering with reference classes, given as dense ids per glyph,
+// through their cluster x class contingency table in O(n + cells).
+ClusterScores scoreClusters(const std::vector<int> &clusterOf, const std::vector<int> &labelOf);
+
+#endif // ASSESS_H
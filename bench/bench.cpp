@@ -0,0 +1,303 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include <boost/filesystem.hpp>
+
+#include "assess.h"
+#include "candidates.h"
+#include "distance.h"
+#include "glyphstore.h"
+#include "methods.h"
+#include "preprocess.h"
+#include "synthetic.h"
+
+namespace fs = boost::filesystem;
+
+using namespace std;
+using namespace cv;
+
+
+namespace {
+
+// Largest number of pairs the distance benchmarks time
+const size_t maxPairs = 1000000;
+
+double seconds(chrono::steady_clock::time_point since) {
+	return chrono::duration<double>(chrono::steady_clock::now() - since).count();
+}
+
+// Calls f until at least minSeconds have passed; seconds per call
+template <typename F>
+double timeRuns(F f, double minSeconds = 0.5) {
+	auto start = chrono::steady_clock::now();
+	int runs = 0;
+	double elapsed;
+	do {
+		f();
+		++runs;
+	} while ((elapsed = seconds(start)) < minSeconds);
+	return elapsed / runs;
+}
+
+long peakRssKb() {
+	rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return usage.ru_maxrss;
+}
+
+// One result as a line of JSON on stdout
+class Result {
+public:
+	Result(const string &benchmark, const string &tag) {
+		out.precision(12);
+		out << "{\"benchmark\": \"" << benchmark << "\"";
+		if (!tag.empty())
+			out << ", \"tag\": \"" << escape(tag) << "\"";
+	}
+
+	Result &add(const string &key, double value) {
+		out << ", \"" << key << "\": " << value;
+		return *this;
+	}
+
+	void print() {
+		out << ", \"peak_rss_kb\": " << peakRssKb() << "}";
+		cout << out.str() << endl;
+	}
+
+private:
+	static string escape(const string &text) {
+		string res;
+		for (char c : text) {
+			if (c == '"' || c == '\\')
+				res += '\\';
+			if ((unsigned char)c >= 0x20)
+				res += c;
+		}
+		return res;
+	}
+
+	ostringstream out;
+};
+
+// Silences the progress output of the functions under test
+class QuietCerr {
+public:
+	QuietCerr() : saved(cerr.rdbuf(nullptr)) { }
+	~QuietCerr() { cerr.rdbuf(saved); }
+
+private:
+	streambuf *saved;
+};
+
+// Pairs partitionParallel would look at, up to maxPairs
+vector<pair<int, int>> candidatePairs(const GlyphStore &store) {
+	SizeGrid grid(store);
+	vector<pair<int, int>> pairs;
+	for (const pair<int, int> &cells : grid.neighbourPairs()) {
+		const SizeGrid::Cell &a = grid.cells[cells.first], &b = grid.cells[cells.second];
+		for (int p = a.begin; p < a.end; ++p) {
+			for (int q = cells.first == cells.second ? p + 1 : b.begin; q < b.end; ++q) {
+				if (pairs.size() == maxPairs)
+					return pairs;
+				pairs.push_back(make_pair(grid.order[p], grid.order[q]));
+			}
+		}
+	}
+	return pairs;
+}
+
+void microbenchmarks(const CorpusParams &params, int threads, const string &tag) {
+
+	SyntheticCorpus corpus(params);
+	cerr << "> Rendering " << corpus.size() << " images" << endl;
+	vector<Mat> images;
+	for (int k = 0; k < corpus.size(); ++k)
+		images.push_back(corpus.render(k));
+
+	vector<Mat> crops(images.size());
+	vector<Point> centres(images.size());
+	cerr << "> cropImage" << endl;
+	double perRun = timeRuns([&] {
+		for (size_t k = 0; k < images.size(); ++k)
+			cropImage(images[k], crops[k], centres[k]);
+	});
+	Result("cropImage", tag)
+		.add("images", images.size())
+		.add("ns_per_image", 1e9 * perRun / images.size())
+		.add("images_per_s", images.size() / perRun)
+		.print();
+
+	GlyphStore store;
+	GroundTruth truth;
+	for (int k = 0; k < corpus.size(); ++k) {
+		store.add(crops[k], centres[k], corpus.fileName(k));
+		truth.add(corpus.fileName(k), to_string(corpus.label(k)));
+	}
+	vector<Mat>().swap(images);
+	vector<Mat>().swap(crops);
+
+	const vector<pair<int, int>> pairs = candidatePairs(store);
+	cerr << "> computeDistance over " << pairs.size() << " candidate pairs" << endl;
+	double checksum = 0;
+	perRun = timeRuns([&] {
+		for (const pair<int, int> &p : pairs)
+			checksum += computeDistance(store, p.first, p.second);
+	});
+	Result("computeDistance", tag)
+		.add("images", store.size())
+		.add("pairs", pairs.size())
+		.add("ns_per_pair", 1e9 * perRun / pairs.size())
+		.add("pairs_per_s", pairs.size() / perRun)
+		.print();
+
+	cerr << "> distanceBelow" << endl;
+	size_t below = 0;
+	perRun = timeRuns([&] {
+		for (const pair<int, int> &p : pairs)
+			below += distanceBelow(store, p.first, p.second, 15.0);
+	});
+	Result("distanceBelow", tag)
+		.add("images", store.size())
+		.add("pairs", pairs.size())
+		.add("ns_per_pair", 1e9 * perRun / pairs.size())
+		.add("pairs_per_s", pairs.size() / perRun)
+		.print();
+
+	cerr << "> partitionMethod" << endl;
+	const double allPairs = (double)store.size() * (store.size() - 1) / 2;
+	vector<vector<int>> clusters;
+	perRun = timeRuns([&] {
+		QuietCerr quiet;
+		clusters.clear();
+		partitionMethod(store, nullptr, clusters, threads);
+	});
+	Result("partitionMethod", tag)
+		.add("images", store.size())
+		.add("threads", threads)
+		.add("clusters", clusters.size())
+		.add("seconds", perRun)
+		.add("ns_per_pair", 1e9 * perRun / allPairs)
+		.add("pairs_per_s", allPairs / perRun)
+		.add("images_per_s", store.size() / perRun)
+		.print();
+
+	cerr << "> assesClusters" << endl;
+	perRun = timeRuns([&] {
+		QuietCerr quiet;
+		assesClusters(store, clusters, truth);
+	});
+	Result("assesClusters", tag)
+		.add("images", store.size())
+		.add("clusters", clusters.size())
+		.add("ns_per_image", 1e9 * perRun / store.size())
+		.print();
+
+	// Keeps the loops above from being optimised away
+	if (checksum < 0 || below > pairs.size() * 1000000)
+		cerr << checksum << below << endl;
+}
+
+// openImages, partitionMethod and, given labels.tsv, assesClusters on a
+// corpus written by gencorpus
+void endToEnd(const fs::path &dir, int threads, int ioThreads, const string &tag) {
+
+	auto start = chrono::steady_clock::now();
+	GlyphStore store;
+	openImages(dir, store, ioThreads, nullptr);
+	const double openSeconds = seconds(start);
+
+	auto clusterStart = chrono::steady_clock::now();
+	vector<vector<int>> clusters;
+	partitionMethod(store, nullptr, clusters, threads);
+	const double clusterSeconds = seconds(clusterStart);
+
+	GroundTruth truth;
+	const bool labelled = truth.load(dir / "labels.tsv");
+	if (labelled)
+		assesClusters(store, clusters, truth);
+
+	const double allPairs = (double)store.size() * (store.size() - 1) / 2;
+	Result result("end-to-end", tag);
+	result
+		.add("images", store.size())
+		.add("threads", threads)
+		.add("io_threads", ioThreads)
+		.add("clusters", clusters.size())
+		.add("open_seconds", openSeconds)
+		.add("images_per_s", store.size() / openSeconds)
+		.add("cluster_seconds", clusterSeconds)
+		.add("ns_per_pair", 1e9 * clusterSeconds / allPairs)
+		.add("pairs_per_s", allPairs / clusterSeconds)
+		.add("seconds", seconds(start))
+		.add("arena_bytes", store.arenaSize());
+	result.print();
+}
+
+} // namespace
+
+
+int main(int argc, char *argv[])
+{
+	CorpusParams params;
+	params.images   = 2000;
+	params.clusters = 200;
+	int threads   = max(1u, thread::hardware_concurrency());
+	int ioThreads = 0;
+	fs::path corpusDir;
+	string tag;
+	bool valid = true;
+
+	for (int i = 1; i < argc; ++i) {
+		string arg = argv[i];
+		if (arg == "--images" && i + 1 < argc)
+			params.images = atoi(argv[++i]);
+		else if (arg == "--clusters" && i + 1 < argc)
+			params.clusters = atoi(argv[++i]);
+		else if (arg == "--seed" && i + 1 < argc)
+			params.seed = strtoull(argv[++i], nullptr, 10);
+		else if (arg == "--threads" && i + 1 < argc)
+			threads = atoi(argv[++i]);
+		else if (arg == "--io-threads" && i + 1 < argc)
+			ioThreads = atoi(argv[++i]);
+		else if (arg == "--corpus" && i + 1 < argc)
+			corpusDir = argv[++i];
+		else if (arg == "--tag" && i + 1 < argc)
+			tag = argv[++i];
+		else
+			valid = false;
+	}
+
+	if (ioThreads == 0)
+		ioThreads = threads;
+
+	if (!valid || params.images < 2 || params.clusters < 1 || threads < 1 || ioThreads < 1) {
+		cerr
+			<< "Usage:" << endl
+			<< argv[0] << " [--images N] [--clusters K] [--seed S] [--threads N] [--tag TEXT]" << endl
+			<< argv[0] << " --corpus DIR [--threads N] [--io-threads N] [--tag TEXT]" << endl
+			<< "Prints one line of JSON per benchmark, with the peak resident set so far." << endl
+			<< "The first form times cropImage, computeDistance, distanceBelow," << endl
+			<< "partitionMethod and assesClusters on N synthetic glyphs (default: 2000)" << endl
+			<< "from K clusters (default: 200), rendered in memory. The second one runs" << endl
+			<< "the whole tool on a corpus written by gencorpus." << endl
+			<< "    --tag TEXT - copied into every result, e.g. the commit" << endl;
+		return 1;
+	}
+
+	if (!corpusDir.empty())
+		endToEnd(corpusDir, threads, ioThreads, tag);
+	else
+		microbenchmarks(params, threads, tag);
+
+	return 0;
+}
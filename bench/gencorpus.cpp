@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <opencv2/highgui/highgui.hpp>
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include "synthetic.h"
+
+namespace fs = boost::filesystem;
+
+using namespace std;
+using namespace cv;
+
+
+int main(int argc, char *argv[])
+{
+	CorpusParams params;
+	int threads = max(1u, thread::hardware_concurrency());
+	vector<string> args;
+
+	for (int i = 1; i < argc; ++i) {
+		string arg = argv[i];
+		if (arg == "--images" && i + 1 < argc)
+			params.images = atoi(argv[++i]);
+		else if (arg == "--clusters" && i + 1 < argc)
+			params.clusters = atoi(argv[++i]);
+		else if (arg == "--jitter" && i + 1 < argc)
+			params.jitter = atoi(argv[++i]);
+		else if (arg == "--size-variation" && i + 1 < argc)
+			params.sizeVariation = atoi(argv[++i]);
+		else if (arg == "--seed" && i + 1 < argc)
+			params.seed = strtoull(argv[++i], nullptr, 10);
+		else if (arg == "--threads" && i + 1 < argc)
+			threads = atoi(argv[++i]);
+		else
+			args.push_back(arg);
+	}
+
+	if (args.size() != 1 || params.images < 1 || params.clusters < 1 || params.jitter < 0
+			|| params.sizeVariation < 0 || threads < 1) {
+		cerr
+			<< "Usage:" << endl
+			<< argv[0] << " [--images N] [--clusters K] [--jitter J] [--size-variation V] [--seed S]" << endl
+			<< "    [--threads N] <output dir>" << endl
+			<< "Writes N synthetic glyphs (default: 1000) drawn from K clusters (default: 100)" << endl
+			<< "as g<number>.png and their clusters as labels.tsv. The same options always" << endl
+			<< "give the same corpus." << endl
+			<< "    --jitter J          - largest shift of a stroke end in pixels (default: 0)" << endl
+			<< "    --size-variation V  - largest change of a glyph's size in pixels (default: 1)" << endl;
+		return 1;
+	}
+
+	fs::path dir(args[0]);
+	boost::system::error_code error;
+	fs::create_directories(dir, error);
+	if (!fs::is_directory(dir)) {
+		cerr << "Could not create \"" << dir.string() << "\"" << endl;
+		return 1;
+	}
+
+	SyntheticCorpus corpus(params);
+	cerr << "> Writing " << corpus.size() << " images to \"" << dir.string() << "\"" << endl;
+
+	atomic<int> next(0);
+	atomic<bool> failed(false);
+	mutex logLock;
+
+	auto work = [&] {
+		for (int k; (k = next++) < corpus.size() && !failed; ) {
+			if (!imwrite((dir / corpus.fileName(k)).string(), corpus.render(k)))
+				failed = true;
+			if ((k + 1) % 10000 == 0) {
+				lock_guard<mutex> guard(logLock);
+				cerr << "\r" << k + 1;
+			}
+		}
+	};
+
+	vector<thread> pool;
+	for (int w = 1; w < threads; ++w)
+		pool.emplace_back(work);
+	work();
+	for (thread &t : pool)
+		t.join();
+
+	if (failed) {
+		cerr << "Could not write the images" << endl;
+		return 1;
+	}
+
+	fs::ofstream labels(dir / "labels.tsv");
+	for (int k = 0; k < corpus.size(); ++k)
+		labels << corpus.fileName(k) << "\t" << corpus.label(k) << "\n";
+	labels.close();
+	if (!labels) {
+		cerr << "Could not write labels.tsv" << endl;
+		return 1;
+	}
+
+	cerr << "\rDone." << endl;
+	return 0;
+}
@@ -0,0 +1,21 @@
+#!/bin/sh
+# Usage: scaling.sh <gencorpus> <bench> <corpora dir> <results file> <size>...
+# Generates a corpus of every size (once; they are deterministic) and appends
+# the end-to-end results for it to the results file, tagged with the commit.
+set -e
+
+gencorpus=$1
+bench=$2
+corpora=$3
+results=$4
+shift 4
+
+tag=$(git describe --always --dirty 2>/dev/null || echo unknown)
+
+for size in "$@"; do
+	dir="$corpora/$size"
+	if [ ! -f "$dir/labels.tsv" ]; then
+		"$gencorpus" --images "$size" --clusters $((size / 10)) "$dir"
+	fi
+	"$bench" --corpus "$dir" --tag "$tag" | tee -a "$results"
+done
@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+#include "synthetic.h"
+
+using namespace std;
+using namespace cv;
+
+
+namespace {
+
+// splitmix64; unlike the std distributions it gives the same numbers with
+// every compiler and standard library
+class Random {
+public:
+	explicit Random(uint64_t seed) : state(seed) { }
+
+	uint64_t next() {
+		uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+		return z ^ (z >> 31);
+	}
+
+	// Uniform in [lo, hi]
+	int between(int lo, int hi) {
+		return lo + (int)(next() % (uint64_t)(hi - lo + 1));
+	}
+
+private:
+	uint64_t state;
+};
+
+uint64_t streamSeed(uint64_t seed, uint64_t stream, uint64_t index) {
+	return Random(seed ^ Random(stream * 0x100000001b3ULL + index).next()).next();
+}
+
+const uint64_t labelStream     = 1;
+const uint64_t prototypeStream = 2;
+const uint64_t imageStream     = 3;
+
+struct Stroke {
+	int x0, y0, x1, y1;
+	int width;
+};
+
+struct Prototype {
+	int cols, rows;
+	int strokes;
+	Stroke stroke[5];
+};
+
+Prototype prototype(uint64_t seed, int cluster) {
+	Random random(streamSeed(seed, prototypeStream, cluster));
+	Prototype p;
+	p.cols    = random.between(8, 40);
+	p.rows    = random.between(12, 48);
+	p.strokes = random.between(2, 5);
+	for (int s = 0; s < p.strokes; ++s) {
+		p.stroke[s] = Stroke{
+			random.between(0, p.cols - 1), random.between(0, p.rows - 1),
+			random.between(0, p.cols - 1), random.between(0, p.rows - 1),
+			random.between(1, 3)
+		};
+	}
+	return p;
+}
+
+void drawStroke(Mat &img, Point a, Point b, int width, uchar ink) {
+	const int steps = max(max(abs(b.x - a.x), abs(b.y - a.y)), 1);
+	for (int s = 0; s <= steps; ++s) {
+		const int x = a.x + (b.x - a.x) * s / steps;
+		const int y = a.y + (b.y - a.y) * s / steps;
+		for (int dy = 0; dy < width; ++dy) {
+			for (int dx = 0; dx < width; ++dx) {
+				if (y + dy >= 0 && y + dy < img.rows && x + dx >= 0 && x + dx < img.cols)
+					img.at<uchar>(y + dy, x + dx) = min(img.at<uchar>(y + dy, x + dx), ink);
+			}
+		}
+	}
+}
+
+} // namespace
+
+
+int SyntheticCorpus::label(int k) const {
+	return (int)(Random(streamSeed(params.seed, labelStream, k)).next() % (uint64_t)params.clusters);
+}
+
+string SyntheticCorpus::fileName(int k) const {
+	char name[32];
+	snprintf(name, sizeof(name), "g%07d.png", k);
+	return name;
+}
+
+Mat SyntheticCorpus::render(int k) const {
+	const Prototype p = prototype(params.seed, label(k));
+	Random random(streamSeed(params.seed, imageStream, k));
+
+	const int cols = max(p.cols + random.between(-params.sizeVariation, params.sizeVariation), 4);
+	const int rows = max(p.rows + random.between(-params.sizeVariation, params.sizeVariation), 4);
+	const int left   = random.between(2, 8), top    = random.between(2, 8);
+	const int right  = random.between(2, 8), bottom = random.between(2, 8);
+	const uchar ink  = random.between(0, 80);
+
+	// Room for the stroke width and the jitter on the right and below
+	Mat img(top + rows + bottom + 3, left + cols + right + 3, CV_8UC1, Scalar(255));
+	auto place = [&](int x, int y) {
+		const int dx = random.between(-params.jitter, params.jitter);
+		const int dy = random.between(-params.jitter, params.jitter);
+		return Point(left + x * (cols - 1) / max(p.cols - 1, 1) + dx, top + y * (rows - 1) / max(p.rows - 1, 1) + dy);
+	};
+
+	for (int s = 0; s < p.strokes; ++s) {
+		const Stroke &stroke = p.stroke[s];
+		const Point a = place(stroke.x0, stroke.y0);
+		const Point b = place(stroke.x1, stroke.y1);
+		drawStroke(img, a, b, stroke.width, ink);
+	}
+	return img;
+}
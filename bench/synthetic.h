@@ -0,0 +1,41 @@
+#ifndef SYNTHETIC_H
+#define SYNTHETIC_H
+
+#include <cstdint>
+#include <string>
+
+#include <opencv2/core/core.hpp>
+
+struct CorpusParams {
+	int      images        = 1000;
+	int      clusters      = 100;
+	int      jitter        = 0;   // largest shift of a stroke end, in pixels
+	int      sizeVariation = 1;   // largest change of width and height, in pixels
+	uint64_t seed          = 1;
+};
+
+// Deterministic synthetic glyphs. Every cluster has a prototype made of a
+// few thick strokes; its images redraw the prototype scaled by the size
+// variation, with jittered stroke ends, a random ink level and random white
+// margins. Image k depends on the parameters and k only, so images can be
+// rendered in any order and on any thread.
+class SyntheticCorpus {
+public:
+	explicit SyntheticCorpus(const CorpusParams &params) : params(params) { }
+
+	int size() const { return params.images; }
+
+	// Cluster of image k, in 0 .. clusters - 1
+	int label(int k) const;
+
+	// "g0000042.png" for image 42
+	std::string fileName(int k) const;
+
+	// Image k, 8 bit grey on white
+	cv::Mat render(int k) const;
+
+private:
+	CorpusParams params;
+};
+
+#endif // SYNTHETIC_H
@@ -0,0 +1,43 @@
+#ifndef BINARYIO_H
+#define BINARYIO_H
+
+#include <istream>
+#include <ostream>
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+// Helpers shared by the binary file formats (glyph cache, cluster model,
+// dendrogram, shard results). Values are stored in native byte order.
+
+template <typename T>
+void writeValue(std::ostream &out, const T &value) {
+	out.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+template <typename T>
+bool readValue(std::istream &in, T &value) {
+	return (bool)in.read(reinterpret_cast<char *>(&value), sizeof(value));
+}
+
+// Calls write(out) on "<file>.tmp" and renames that to file if it all got
+// written, so a failed or crashed write leaves the old file as it was and
+// existing mappings of it stay valid.
+template <typename Write>
+bool replaceFile(const boost::filesystem::path &file, Write write) {
+
+	boost::filesystem::path tmp = file;
+	tmp += ".tmp";
+	boost::filesystem::ofstream out(tmp, std::ios::binary);
+	write(out);
+
+	out.close();
+	if (!out)
+		return false;
+
+	boost::system::error_code error;
+	boost::filesystem::rename(tmp, file, error);
+	return !error;
+}
+
+#endif // BINARYIO_H
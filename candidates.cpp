@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <cstdlib>
+
+#include "candidates.h"
+#include "distance.h"
+
+using namespace std;
+using namespace cv;
+
+
+GlyphProfile::GlyphProfile(const GlyphStore &store, int i)
+	: rowPrefix(store.rows(i) + 2, 0), colPrefix(store.cols(i) + 2, 0) {
+
+	const int rows = store.rows(i), cols = store.cols(i);
+	vector<int> colInk(cols, 0);
+
+	for (int y = 0; y < rows; ++y) {
+		const uchar *row = store.pixel(i, y, 0);
+		int ink = 0;
+		for (int x = 0; x < cols; ++x) {
+			ink       += 255 - row[x];
+			colInk[x] += 255 - row[x];
+		}
+		rowPrefix[y + 1] = rowPrefix[y] + ink;
+	}
+	rowPrefix[rows + 1] = rowPrefix[rows];
+
+	for (int x = 0; x < cols; ++x)
+		colPrefix[x + 1] = colPrefix[x] + colInk[x];
+	colPrefix[cols + 1] = colPrefix[cols];
+}
+
+
+bool profilesApart(const GlyphStore &store, int i, const GlyphProfile &p1,
+                   int j, const GlyphProfile &p2, float threshold) {
+
+	Point tl, br;
+	overlapBounds(store, i, j, tl, br);
+	const int weights = overlapWeight(tl, br);
+	auto apart = [&](int bound) {
+		return (float)bound / weights >= threshold;
+	};
+
+	// The overlap as rows [y1, y1 + rows) and columns [x1, x1 + cols) of glyph i
+	const int rows = br.y - tl.y + 1, cols = br.x - tl.x + 1;
+	const Point m1 = store.massCentre(i), m2 = store.massCentre(j);
+	const int y1 = m1.y + tl.y, y2 = m2.y + tl.y;
+	const int x1 = m1.x + tl.x, x2 = m2.x + tl.x;
+
+	const int outRows1 = p1.ink() - p1.rowsInk(y1, rows), outRows2 = p2.ink() - p2.rowsInk(y2, rows);
+	const int outCols1 = p1.ink() - p1.colsInk(x1, cols), outCols2 = p2.ink() - p2.colsInk(x2, cols);
+
+	if (apart(abs(p1.ink() - p2.ink()) - outRows1 - outCols1 - outRows2 - outCols2))
+		return true;
+
+	int rowsDiff = 0;
+	for (int k = 0; k < rows; ++k)
+		rowsDiff += abs(p1.rowInk(y1 + k) - p2.rowInk(y2 + k));
+	if (apart(rowsDiff - outCols1 - outCols2))
+		return true;
+
+	int colsDiff = 0;
+	for (int k = 0; k < cols; ++k)
+		colsDiff += abs(p1.colInk(x1 + k) - p2.colInk(x2 + k));
+	return apart(colsDiff - outRows1 - outRows2);
+}
+
+
+SizeGrid::SizeGrid(const GlyphStore &store) : order(store.size()) {
+
+	auto cellOf = [&](int i) {
+		return make_pair(store.cols(i) / cellSize, store.rows(i) / cellSize);
+	};
+
+	for (size_t i = 0; i < order.size(); ++i)
+		order[i] = i;
+	stable_sort(order.begin(), order.end(), [&](int a, int b) {
+		return cellOf(a) < cellOf(b);
+	});
+
+	for (size_t k = 0; k < order.size(); ++k) {
+		pair<int, int> cell = cellOf(order[k]);
+		if (cells.empty() || cells.back().x != cell.first || cells.back().y != cell.second)
+			cells.push_back(Cell{ cell.first, cell.second, (int)k, (int)k });
+		++cells.back().end;
+	}
+}
+
+int SizeGrid::find(int x, int y) const {
+	auto it = lower_bound(cells.begin(), cells.end(), make_pair(x, y), [](const Cell &c, const pair<int, int> &key) {
+		return make_pair(c.x, c.y) < key;
+	});
+	return it != cells.end() && it->x == x && it->y == y ? it - cells.begin() : -1;
+}
+
+int SizeGrid::cellOf(const GlyphStore &store, int i) const {
+	return find(store.cols(i) / cellSize, store.rows(i) / cellSize);
+}
+
+vector<int> SizeGrid::neighbours(int cell) const {
+	vector<int> res;
+	for (int dx = -1; dx <= 1; ++dx) {
+		for (int dy = -1; dy <= 1; ++dy) {
+			int other = find(cells[cell].x + dx, cells[cell].y + dy);
+			if (other >= 0)
+				res.push_back(other);
+		}
+	}
+	return res;
+}
+
+vector<pair<int, int>> SizeGrid::neighbourPairs() const {
+
+	// The cell itself and the four adjacent ones that sort after it
+	const int dx[] = { 0, 0, 1, 1, 1 };
+	const int dy[] = { 0, 1, -1, 0, 1 };
+
+	vector<pair<int, int>> res;
+	for (size_t a = 0; a < cells.size(); ++a) {
+		for (int k = 0; k < 5; ++k) {
+			int b = find(cells[a].x + dx[k], cells[a].y + dy[k]);
+			if (b >= 0)
+				res.push_back(make_pair(a, b));
+		}
+	}
+	return res;
+}
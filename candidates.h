@@ -0,0 +1,65 @@
+#ifndef CANDIDATES_H
+#define CANDIDATES_H
+
+#include <utility>
+#include <vector>
+
+#include "distance.h"
+#include "glyphstore.h"
+
+// Row and column ink (255 - value) projections of a glyph, as prefix sums
+// that also cover the white border row and column computeDistance reads.
+class GlyphProfile {
+public:
+	GlyphProfile(const GlyphStore &store, int i);
+
+	int ink() const { return rowPrefix.back(); }
+	int rowInk(int y) const { return rowPrefix[y + 1] - rowPrefix[y]; }
+	int colInk(int x) const { return colPrefix[x + 1] - colPrefix[x]; }
+
+	// Ink of rows [y, y + n) and columns [x, x + n)
+	int rowsInk(int y, int n) const { return rowPrefix[y + n] - rowPrefix[y]; }
+	int colsInk(int x, int n) const { return colPrefix[x + n] - colPrefix[x]; }
+
+private:
+	std::vector<int> rowPrefix, colPrefix;
+};
+
+// True if the profiles alone prove computeDistance(store, i, j) >= threshold.
+// All weights are at least 1, so the weighted sum is bounded from below by
+// the difference of ink masses and by the differences of row and column
+// projections over the overlap, less the ink lying outside of it.
+bool profilesApart(const GlyphStore &store, int i, const GlyphProfile &p1,
+                   int j, const GlyphProfile &p2, float threshold);
+
+// Glyphs bucketed by (cols, rows) on a grid of maxSizeDiff + 1 pixel cells.
+// Pairs that pass the size check of computeDistance always lie in the same
+// or in adjacent cells.
+class SizeGrid {
+public:
+	struct Cell {
+		int x, y;
+		int begin, end;   // range of order
+	};
+
+	static const int cellSize = maxSizeDiff + 1;
+
+	explicit SizeGrid(const GlyphStore &store);
+
+	// Cell holding glyphs of the size of glyph i, or -1 if there is none
+	int cellOf(const GlyphStore &store, int i) const;
+
+	// The cell and all adjacent ones
+	std::vector<int> neighbours(int cell) const;
+
+	// Pairs of cells a <= b holding all comparable pairs of glyphs, each once
+	std::vector<std::pair<int, int>> neighbourPairs() const;
+
+	std::vector<int>  order;   // glyph indices sorted by cell
+	std::vector<Cell> cells;
+
+private:
+	int find(int x, int y) const;
+};
+
+#endif // CANDIDATES_H
@@ -0,0 +1,245 @@
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "candidates.h"
+#include "cluster.h"
+#include "unionfind.h"
+
+using namespace std;
+
+
+namespace {
+
+// Tiles cover at most blockSize x blockSize pairs of images
+const int blockSize = 128;
+
+// Pairs of glyphs order[aBegin, aEnd) x order[bBegin, bEnd). Diagonal tiles
+// pair a range with itself and only cover each pair once.
+struct Tile {
+	int  aBegin, aEnd;
+	int  bBegin, bEnd;
+	bool diagonal;
+};
+
+// Tiles [begin, end) still owned by one worker. The owner takes tiles from
+// the front, thieves split off the back half.
+struct TileRange {
+	mutex  lock;
+	size_t begin = 0;
+	size_t end   = 0;
+};
+
+class TileScheduler {
+public:
+	TileScheduler(size_t tiles, int workers) : workers(workers), ranges(new TileRange[workers]) {
+		for (int w = 0; w < workers; ++w) {
+			ranges[w].begin = tiles *  w      / workers;
+			ranges[w].end   = tiles * (w + 1) / workers;
+		}
+	}
+
+	bool next(int worker, size_t &tile) {
+		if (take(worker, tile))
+			return true;
+
+		// Nothing new is ever scheduled, so one fruitless round means we are done
+		for (int k = 1; k < workers; ++k) {
+			if (steal((worker + k) % workers, worker))
+				return take(worker, tile) || next(worker, tile);
+		}
+		return false;
+	}
+
+private:
+	bool take(int worker, size_t &tile) {
+		TileRange &own = ranges[worker];
+		lock_guard<mutex> guard(own.lock);
+		if (own.begin == own.end)
+			return false;
+		tile = own.begin++;
+		return true;
+	}
+
+	bool steal(int victim, int worker) {
+		size_t begin, end;
+		{
+			TileRange &other = ranges[victim];
+			lock_guard<mutex> guard(other.lock);
+			if (other.begin == other.end)
+				return false;
+			begin = other.begin + (other.end - other.begin) / 2;
+			end   = other.end;
+			other.end = begin;
+		}
+		TileRange &own = ranges[worker];
+		lock_guard<mutex> guard(own.lock);
+		own.begin = begin;
+		own.end   = end;
+		return true;
+	}
+
+	int workers;
+	unique_ptr<TileRange[]> ranges;
+};
+
+
+// Calls match(worker, i, j) from a pool of threads for every pair of glyphs
+// closer than threshold, except for pairs rejected by skip(i, j) up front.
+// Only glyphs in neighbouring size cells are ever compared, and profilesApart
+// and then the bit planes, if given, filter them before distanceBelow.
+template <typename Skip, typename Match>
+void forEachMatch(const GlyphStore &store, const GlyphBits *bits, float threshold, int threads,
+                  PartitionStats &stats, Skip skip, Match match) {
+
+	const int n = store.size();
+	vector<GlyphProfile> profiles;
+	profiles.reserve(n);
+	for (int i = 0; i < n; ++i)
+		profiles.emplace_back(store, i);
+
+	// Pairs of neighbouring cells are cut into tiles of at most blockSize x
+	// blockSize pairs
+	SizeGrid grid(store);
+	vector<Tile> tiles;
+	stats.pairs      = (unsigned long long)n * (n - 1) / 2;
+	stats.candidates = 0;
+
+	for (const pair<int, int> &cells : grid.neighbourPairs()) {
+		const SizeGrid::Cell &a = grid.cells[cells.first], &b = grid.cells[cells.second];
+		const bool diagonal = cells.first == cells.second;
+		unsigned long long na = a.end - a.begin, nb = b.end - b.begin;
+		stats.candidates += diagonal ? na * (na - 1) / 2 : na * nb;
+
+		for (int i = a.begin; i < a.end; i += blockSize) {
+			for (int j = diagonal ? i : b.begin; j < b.end; j += blockSize) {
+				tiles.push_back(Tile{ i, min(i + blockSize, a.end), j, min(j + blockSize, b.end), diagonal && i == j });
+			}
+		}
+	}
+
+	TileScheduler scheduler(tiles.size(), threads);
+	mutex statsLock;
+
+	auto work = [&](int worker) {
+		PairTester tester(store, bits, threshold, stats.sampleEvery);
+		size_t next;
+		while (scheduler.next(worker, next)) {
+			const Tile &tile = tiles[next];
+			for (int p = tile.aBegin; p < tile.aEnd; ++p) {
+				const int i = grid.order[p];
+				for (int q = tile.diagonal ? p + 1 : tile.bBegin; q < tile.bEnd; ++q) {
+					const int j = grid.order[q];
+
+					if (skip(i, j))
+						continue;
+
+					if (tester.close(i, profiles[i], j, profiles[j]))
+						match(worker, i, j);
+				}
+			}
+		}
+
+		lock_guard<mutex> guard(statsLock);
+		tester.addTo(stats);
+	};
+
+	vector<thread> pool;
+	for (int w = 1; w < threads; ++w)
+		pool.emplace_back(work, w);
+	work(0);
+	for (thread &t : pool)
+		t.join();
+}
+
+// Cuts edges down to their minimum spanning forest over n glyphs. Every edge
+// left out is the largest on some cycle, so it is not in the minimum
+// spanning forest of any larger set of edges either.
+void reduceToForest(vector<MergeEdge> &edges, int n) {
+	sort(edges.begin(), edges.end());
+	ConcurrentUnionFind sets(n);
+	size_t kept = 0;
+	for (const MergeEdge &e : edges) {
+		if (sets.unite(e.a, e.b))
+			edges[kept++] = e;
+	}
+	edges.resize(kept);
+}
+
+} // namespace
+
+
+bool PairTester::traced(int i, const GlyphProfile &pi, int j, const GlyphProfile &pj) {
+	countdown = sampleEvery;
+	auto start = chrono::steady_clock::now();
+	const PairOutcome outcome = test(i, pi, j, pj);
+	const float nanoseconds = chrono::duration<float, nano>(chrono::steady_clock::now() - start).count();
+	samples.push_back(PairSample{ i, j, outcome, nanoseconds });
+	return outcome == PairOutcome::match;
+}
+
+void PairTester::addTo(PartitionStats &stats) const {
+	stats.distance  += distance;
+	stats.pruned    += pruned;
+	stats.bitPruned += bitPruned;
+	stats.samples.insert(stats.samples.end(), samples.begin(), samples.end());
+}
+
+int partitionParallel(const GlyphStore &store, const GlyphBits *bits, float threshold, int threads,
+                      vector<int> &labels, PartitionStats &stats) {
+
+	ConcurrentUnionFind sets(store.size());
+	threads = max(1, threads);
+
+	// As in cv::partition, pairs already known to be connected are skipped
+	forEachMatch(store, bits, threshold, threads, stats,
+		[&](int i, int j) { return sets.same(i, j); },
+		[&](int, int i, int j) { sets.unite(i, j); });
+
+	return sets.components(labels);
+}
+
+int partitionAcross(const GlyphStore &store, const GlyphBits *bits, float threshold, int split, int threads,
+                    vector<int> &labels, PartitionStats &stats) {
+
+	ConcurrentUnionFind sets(store.size());
+	threads = max(1, threads);
+
+	forEachMatch(store, bits, threshold, threads, stats,
+		[&](int i, int j) { return (i < split) == (j < split) || sets.same(i, j); },
+		[&](int, int i, int j) { sets.unite(i, j); });
+	stats.pairs = (unsigned long long)split * (store.size() - split);
+
+	return sets.components(labels);
+}
+
+void minimumSpanningForest(const GlyphStore &store, const GlyphBits *bits, float maxThreshold, int threads,
+                           vector<MergeEdge> &forest, PartitionStats &stats) {
+
+	threads = max(1, threads);
+	const int n = store.size();
+
+	// Every worker keeps its edges down to a forest whenever they pile up, so
+	// memory stays linear in the number of glyphs however many pairs match
+	const size_t limit = max<size_t>(2 * (size_t)n, 1 << 16);
+	vector<vector<MergeEdge>> edges(threads);
+
+	forEachMatch(store, bits, maxThreshold, threads, stats,
+		[](int, int) { return false; },
+		[&](int worker, int i, int j) {
+			edges[worker].push_back(MergeEdge{ computeDistance(store, i, j), i, j });
+			if (edges[worker].size() >= limit)
+				reduceToForest(edges[worker], n);
+		});
+
+	// Kruskal over the forests of all workers
+	forest.clear();
+	for (int w = 0; w < threads; ++w) {
+		reduceToForest(edges[w], n);
+		forest.insert(forest.end(), edges[w].begin(), edges[w].end());
+		vector<MergeEdge>().swap(edges[w]);
+	}
+	reduceToForest(forest, n);
+}
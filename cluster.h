@@ -0,0 +1,120 @@
+#ifndef CLUSTER_H
+#define CLUSTER_H
+
+#include <vector>
+
+#include "candidates.h"
+#include "distance.h"
+#include "glyphbits.h"
+#include "glyphstore.h"
+
+// What became of a pair that reached the candidate filters
+enum class PairOutcome : unsigned char {
+	sizes,       // rejected by the size check of distanceBelow
+	profiles,    // ruled out by profilesApart
+	bitPlanes,   // ruled out by GlyphBits::apart
+	apart,       // not closer than the threshold
+	match
+};
+
+// A pair traced in sampling mode
+struct PairSample {
+	int         a, b;
+	PairOutcome outcome;
+	float       nanoseconds;   // in the filters and distanceBelow together
+};
+
+struct PartitionStats {
+	unsigned long long pairs      = 0;   // all pairs of glyphs
+	unsigned long long candidates = 0;   // pairs in neighbouring size cells
+	unsigned long long pruned     = 0;   // candidates ruled out by their profiles
+	unsigned long long bitPruned  = 0;   // the rest ruled out by their bit planes
+	DistanceStats      distance;
+
+	// Set by the caller to trace every sampleEvery-th pair that reaches the
+	// filters in each thread; 0 traces none
+	unsigned                sampleEvery = 0;
+	std::vector<PairSample> samples;
+};
+
+// Runs pairs through profilesApart, bits->apart unless bits is null, and
+// distanceBelow, counting what filtered them out. One per thread; sampling
+// costs a decrement per pair and two clock reads per traced one.
+class PairTester {
+public:
+	PairTester(const GlyphStore &store, const GlyphBits *bits, float threshold, unsigned sampleEvery)
+		: store(store), bits(bits), threshold(threshold), sampleEvery(sampleEvery), countdown(sampleEvery) { }
+
+	// True if glyphs i and j are closer than threshold
+	bool close(int i, const GlyphProfile &pi, int j, const GlyphProfile &pj) {
+		if (sampleEvery != 0 && --countdown == 0)
+			return traced(i, pi, j, pj);
+		return test(i, pi, j, pj) == PairOutcome::match;
+	}
+
+	// Adds the counters and samples to stats
+	void addTo(PartitionStats &stats) const;
+
+private:
+	PairOutcome test(int i, const GlyphProfile &pi, int j, const GlyphProfile &pj) {
+		const bool differ = sizesDiffer(store, i, j);
+		if (!differ) {
+			if (profilesApart(store, i, pi, j, pj, threshold)) {
+				++pruned;
+				return PairOutcome::profiles;
+			}
+			if (bits && bits->apart(i, j, threshold)) {
+				++bitPruned;
+				return PairOutcome::bitPlanes;
+			}
+		}
+		if (distanceBelow(store, i, j, threshold, &distance))
+			return PairOutcome::match;
+		return differ ? PairOutcome::sizes : PairOutcome::apart;
+	}
+
+	bool traced(int i, const GlyphProfile &pi, int j, const GlyphProfile &pj);
+
+	const GlyphStore &store;
+	const GlyphBits  *bits;
+	float             threshold;
+	unsigned          sampleEvery, countdown;
+
+	unsigned long long      pruned = 0, bitPruned = 0;
+	DistanceStats           distance;
+	std::vector<PairSample> samples;
+};
+
+// Threshold single-linkage clustering: glyphs closer than threshold end up in
+// one cluster, exactly as with cv::partition over distanceBelow. Candidate
+// pairs come from a SizeGrid and are filtered by profilesApart first, and
+// by bits->apart unless bits is null. They are cut into tiles shared by a
+// pool of work-stealing threads, and clusters are merged in a lock-free
+// union-find. Labels are numbered in order of first appearance in the store,
+// like cv::partition does. Returns the number of clusters.
+int partitionParallel(const GlyphStore &store, const GlyphBits *bits, float threshold, int threads,
+                      std::vector<int> &labels, PartitionStats &stats);
+
+// Same as partitionParallel, but only pairs of one glyph below split and one
+// at or above it are compared.
+int partitionAcross(const GlyphStore &store, const GlyphBits *bits, float threshold, int split, int threads,
+                    std::vector<int> &labels, PartitionStats &stats);
+
+// Edge of the single-linkage graph
+struct MergeEdge {
+	float distance;
+	int   a, b;
+
+	bool operator<(const MergeEdge &other) const {
+		return distance != other.distance ? distance < other.distance
+		     : a != other.a ? a < other.a : b < other.b;
+	}
+};
+
+// Minimum spanning forest of the graph joining glyphs closer than
+// maxThreshold, sorted by distance. Cutting it at any threshold up to
+// maxThreshold gives the same clusters as partitionParallel.
+void minimumSpanningForest(const GlyphStore &store, const GlyphBits *bits, float maxThreshold, int threads,
+                           std::vector<MergeEdge> &forest, PartitionStats &stats);
+
+#endif // CLUSTER_H
@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <cstring>
+
+#include <boost/filesystem/fstream.hpp>
+
+#include "binaryio.h"
+#include "dendrogram.h"
+#include "unionfind.h"
+
+namespace fs = boost::filesystem;
+
+using namespace std;
+
+
+namespace {
+
+const char dendrogramMagic[8] = { 'G', 'L', 'Y', 'P', 'H', 'D', 'G', '2' };
+
+} // namespace
+
+
+// Layout: magic, glyph count, edge count, images hash, maxThreshold, then
+// every name as its length and bytes, then the edges as (distance, a, b).
+bool Dendrogram::save(const fs::path &file) const {
+
+	return replaceFile(file, [&](ostream &out) {
+		out.write(dendrogramMagic, sizeof(dendrogramMagic));
+		writeValue(out, (uint32_t)names.size());
+		writeValue(out, (uint32_t)edges.size());
+		writeValue(out, imagesHash);
+		writeValue(out, maxThreshold);
+
+		for (const string &name : names) {
+			writeValue(out, (uint32_t)name.size());
+			out.write(name.data(), name.size());
+		}
+
+		for (const MergeEdge &e : edges) {
+			writeValue(out, e.distance);
+			writeValue(out, (int32_t)e.a);
+			writeValue(out, (int32_t)e.b);
+		}
+	});
+}
+
+bool Dendrogram::load(const fs::path &file) {
+
+	fs::ifstream in(file, ios::binary);
+	char magic[sizeof(dendrogramMagic)];
+	uint32_t glyphs, merges;
+
+	if (!in.read(magic, sizeof(magic)) || memcmp(magic, dendrogramMagic, sizeof(magic)) != 0
+			|| !readValue(in, glyphs) || !readValue(in, merges)
+			|| !readValue(in, imagesHash) || !readValue(in, maxThreshold)
+			|| merges >= max<uint32_t>(glyphs, 1))
+		return false;
+
+	names.assign(glyphs, string());
+	for (string &name : names) {
+		uint32_t length;
+		if (!readValue(in, length))
+			return false;
+		name.resize(length);
+		if (!in.read(&name[0], length))
+			return false;
+	}
+
+	edges.assign(merges, MergeEdge());
+	for (MergeEdge &e : edges) {
+		int32_t a, b;
+		if (!readValue(in, e.distance) || !readValue(in, a) || !readValue(in, b)
+				|| a < 0 || b < 0 || (uint32_t)a >= glyphs || (uint32_t)b >= glyphs)
+			return false;
+		e.a = a;
+		e.b = b;
+	}
+
+	return is_sorted(edges.begin(), edges.end());
+}
+
+int Dendrogram::cut(float threshold, vector<int> &labels) const {
+
+	ConcurrentUnionFind sets(names.size());
+	for (const MergeEdge &e : edges) {
+		if (!(e.distance < threshold))
+			break;
+		sets.unite(e.a, e.b);
+	}
+
+	return sets.components(labels);
+}
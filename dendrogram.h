@@ -0,0 +1,30 @@
+#ifndef DENDROGRAM_H
+#define DENDROGRAM_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "cluster.h"
+
+// Single-linkage dendrogram of a set of glyphs, stored as the minimum
+// spanning forest of their distance graph up to maxThreshold. Clusters for
+// any threshold up to that can be cut from it without touching the images.
+class Dendrogram {
+public:
+	bool load(const boost::filesystem::path &file);
+	bool save(const boost::filesystem::path &file) const;
+
+	// Clusters of glyphs closer than threshold, labelled like partitionParallel.
+	// Returns the number of clusters.
+	int cut(float threshold, std::vector<int> &labels) const;
+
+	std::vector<std::string> names;   // glyph file names, by index
+	uint64_t                 imagesHash = 0;   // hashImages of the input directory
+	float                    maxThreshold = 0;
+	std::vector<MergeEdge>   edges;   // sorted by distance
+};
+
+#endif // DENDROGRAM_H
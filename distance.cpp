@@ -0,0 +1,355 @@
+#include <cstdlib>
+#include <cstddef>
+#include <algorithm>
+
+#ifdef __SSE2__
+#include <immintrin.h>
+#endif
+
+// AVX2 kernels are compiled per function and picked at runtime
+#if defined(__GNUC__) && defined(__SSE2__)
+#define DISTANCE_AVX2
+#endif
+
+#include "distance.h"
+#include "mask.h"
+
+using namespace std;
+using namespace cv;
+
+
+namespace {
+
+const int maskRadius  = 15;
+const int maskSize    = 2 * maskRadius + 1;
+const int planeStride = 32;
+const int satStride   = maskSize + 1;
+
+// weightsMask + weightsMask2 merged into one flat plane centred on the mass
+// centre (rows padded to 32 bytes), plus its summed area table so the total
+// weight of any overlap is known without touching the pixels.
+struct WeightPlane {
+	alignas(32) uchar w[maskSize * planeStride];
+	int sat[satStride * satStride];
+};
+
+constexpr WeightPlane makeWeightPlane() {
+	WeightPlane p{};
+	for (int y = 0; y < maskSize; ++y) {
+		for (int x = 0; x < maskSize; ++x) {
+			int w = weightsMask[y][x] + weightsMask2[y][x];
+			p.w[y * planeStride + x] = w;
+			p.sat[(y + 1) * satStride + x + 1] = w
+				+ p.sat[ y      * satStride + x + 1]
+				+ p.sat[(y + 1) * satStride + x    ]
+				- p.sat[ y      * satStride + x    ];
+		}
+	}
+	return p;
+}
+
+constexpr WeightPlane weightPlane = makeWeightPlane();
+
+constexpr int minWeight(const WeightPlane &p) {
+	int res = 255;
+	for (int y = 0; y < maskSize; ++y)
+		for (int x = 0; x < maskSize; ++x)
+			res = p.w[y * planeStride + x] < res ? p.w[y * planeStride + x] : res;
+	return res;
+}
+
+static_assert(minWeight(weightPlane) >= 1, "lower bounds on distances assume weights of at least 1");
+
+// Row kernels: sum of |a - b| and sum of w * |a - b| over n pixels.
+
+int rowSadScalar(const uchar *a, const uchar *b, int n) {
+	int sum = 0;
+	for (int i = 0; i < n; ++i)
+		sum += abs(a[i] - b[i]);
+	return sum;
+}
+
+int rowWeightedScalar(const uchar *a, const uchar *b, const uchar *w, int n) {
+	int sum = 0;
+	for (int i = 0; i < n; ++i)
+		sum += w[i] * abs(a[i] - b[i]);
+	return sum;
+}
+
+#ifdef __SSE2__
+
+inline __m128i absDiffSse2(__m128i a, __m128i b) {
+	return _mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a));
+}
+
+inline int hsumEpi32(__m128i v) {
+	v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+	v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+	return _mm_cvtsi128_si32(v);
+}
+
+int rowSadSse2(const uchar *a, const uchar *b, int n) {
+	__m128i acc = _mm_setzero_si128();
+	int i = 0;
+	for (; i + 16 <= n; i += 16) {
+		__m128i va = _mm_loadu_si128((const __m128i *)(a + i));
+		__m128i vb = _mm_loadu_si128((const __m128i *)(b + i));
+		acc = _mm_add_epi64(acc, _mm_sad_epu8(va, vb));
+	}
+	if (i + 8 <= n) {
+		__m128i va = _mm_loadl_epi64((const __m128i *)(a + i));
+		__m128i vb = _mm_loadl_epi64((const __m128i *)(b + i));
+		acc = _mm_add_epi64(acc, _mm_sad_epu8(va, vb));
+		i += 8;
+	}
+	// _mm_sad_epu8 leaves two 16-bit sums in the low words of each half
+	return hsumEpi32(acc) + rowSadScalar(a + i, b + i, n - i);
+}
+
+int rowWeightedSse2(const uchar *a, const uchar *b, const uchar *w, int n) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i ones = _mm_set1_epi16(1);
+	__m128i acc = zero;
+	int i = 0;
+	for (; i + 16 <= n; i += 16) {
+		__m128i d  = absDiffSse2(_mm_loadu_si128((const __m128i *)(a + i)), _mm_loadu_si128((const __m128i *)(b + i)));
+		__m128i wv = _mm_loadu_si128((const __m128i *)(w + i));
+		__m128i lo = _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), _mm_unpacklo_epi8(wv, zero));
+		__m128i hi = _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), _mm_unpackhi_epi8(wv, zero));
+		// weights are at most 6, so two products still fit in 16 bits
+		acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_add_epi16(lo, hi), ones));
+	}
+	if (i + 8 <= n) {
+		__m128i d  = absDiffSse2(_mm_loadl_epi64((const __m128i *)(a + i)), _mm_loadl_epi64((const __m128i *)(b + i)));
+		__m128i wv = _mm_loadl_epi64((const __m128i *)(w + i));
+		acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_unpacklo_epi8(d, zero), _mm_unpacklo_epi8(wv, zero)));
+		i += 8;
+	}
+	return hsumEpi32(acc) + rowWeightedScalar(a + i, b + i, w + i, n - i);
+}
+
+#endif // __SSE2__
+
+#ifdef DISTANCE_AVX2
+
+// These must not call back into the SSE2 kernels above: mixing legacy SSE
+// and VEX code with dirty upper halves costs far more than the kernel itself.
+
+__attribute__((target("avx2")))
+int rowSadAvx2(const uchar *a, const uchar *b, int n) {
+	__m256i acc = _mm256_setzero_si256();
+	int i = 0;
+	for (; i + 32 <= n; i += 32) {
+		__m256i va = _mm256_loadu_si256((const __m256i *)(a + i));
+		__m256i vb = _mm256_loadu_si256((const __m256i *)(b + i));
+		acc = _mm256_add_epi64(acc, _mm256_sad_epu8(va, vb));
+	}
+	__m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+	if (i + 16 <= n) {
+		s = _mm_add_epi64(s, _mm_sad_epu8(_mm_loadu_si128((const __m128i *)(a + i)), _mm_loadu_si128((const __m128i *)(b + i))));
+		i += 16;
+	}
+	if (i + 8 <= n) {
+		s = _mm_add_epi64(s, _mm_sad_epu8(_mm_loadl_epi64((const __m128i *)(a + i)), _mm_loadl_epi64((const __m128i *)(b + i))));
+		i += 8;
+	}
+	int sum = hsumEpi32(s);
+	for (; i < n; ++i)
+		sum += abs(a[i] - b[i]);
+	return sum;
+}
+
+__attribute__((target("avx2")))
+int rowWeightedAvx2(const uchar *a, const uchar *b, const uchar *w, int n) {
+	const __m256i ones = _mm256_set1_epi16(1);
+	__m256i acc = _mm256_setzero_si256();
+	int i = 0;
+	for (; i + 16 <= n; i += 16) {
+		__m128i d  = absDiffSse2(_mm_loadu_si128((const __m128i *)(a + i)), _mm_loadu_si128((const __m128i *)(b + i)));
+		__m256i wd = _mm256_mullo_epi16(_mm256_cvtepu8_epi16(d), _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(w + i))));
+		acc = _mm256_add_epi32(acc, _mm256_madd_epi16(wd, ones));
+	}
+	__m128i s = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+	if (i + 8 <= n) {
+		__m128i d  = absDiffSse2(_mm_loadl_epi64((const __m128i *)(a + i)), _mm_loadl_epi64((const __m128i *)(b + i)));
+		__m128i wd = _mm_mullo_epi16(_mm_cvtepu8_epi16(d), _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(w + i))));
+		s = _mm_add_epi32(s, _mm_madd_epi16(wd, _mm256_castsi256_si128(ones)));
+		i += 8;
+	}
+	int sum = hsumEpi32(s);
+	for (; i < n; ++i)
+		sum += w[i] * abs(a[i] - b[i]);
+	return sum;
+}
+
+#endif // DISTANCE_AVX2
+
+
+struct RowKernels {
+	const char *name;
+	int (*sad)(const uchar *a, const uchar *b, int n);
+	int (*weighted)(const uchar *a, const uchar *b, const uchar *w, int n);
+};
+
+RowKernels selectKernels() {
+#ifdef DISTANCE_AVX2
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		return { "avx2", rowSadAvx2, rowWeightedAvx2 };
+#endif
+#ifdef __SSE2__
+	return { "sse2", rowSadSse2, rowWeightedSse2 };
+#else
+	return { "scalar", rowSadScalar, rowWeightedScalar };
+#endif
+}
+
+const RowKernels kernels = selectKernels();
+
+
+// Overlap of two glyphs aligned on their mass centres. Rows are addressed by
+// their offset dy from the centre; within the window, columns [x0, x1] take
+// their weights from the plane and everything else has weight 1.
+struct Overlap {
+	Overlap(const GlyphStore &store, int i, int j) {
+		overlapBounds(store, i, j, tl, br);
+
+		const Point m1 = store.massCentre(i), m2 = store.massCentre(j);
+		c1 = store.pixel(i, m1.y, m1.x + tl.x);
+		c2 = store.pixel(j, m2.y, m2.x + tl.x);
+		step1 = store.step(i);
+		step2 = store.step(j);
+
+		x0 = max(tl.x, -maskRadius);
+		x1 = min(br.x, maskRadius);
+	}
+
+	static bool inWindow(int dy) {
+		return dy >= -maskRadius && dy <= maskRadius;
+	}
+
+	// Row outside the window
+	int plainRow(int dy) const {
+		return kernels.sad(c1 + dy * step1, c2 + dy * step2, br.x - tl.x + 1);
+	}
+
+	// Weighted part of a row within the window
+	int windowRow(int dy) const {
+		const uchar *w = weightPlane.w + (dy + maskRadius) * planeStride + (x0 + maskRadius);
+		return kernels.weighted(c1 + dy * step1 + (x0 - tl.x), c2 + dy * step2 + (x0 - tl.x), w, x1 - x0 + 1);
+	}
+
+	// Parts of a row within the window that lie left and right of it
+	int windowRowRest(int dy) const {
+		const uchar *r1 = c1 + dy * step1, *r2 = c2 + dy * step2;
+		return kernels.sad(r1, r2, x0 - tl.x)
+		     + kernels.sad(r1 + (x1 + 1 - tl.x), r2 + (x1 + 1 - tl.x), br.x - x1);
+	}
+
+	Point tl, br;
+	const uchar *c1, *c2;   // first column of the overlap in the centre rows
+	ptrdiff_t step1, step2;
+	int x0, x1;
+};
+
+bool earlyExit(DistanceStats *stats) {
+	if (stats)
+		++stats->earlyExits;
+	return false;
+}
+
+} // namespace
+
+
+void overlapBounds(const GlyphStore &store, int i, int j, Point &tl, Point &br) {
+	const Point m1 = store.massCentre(i), m2 = store.massCentre(j);
+	tl = Point(
+		-min(m1.x, m2.x),
+		-min(m1.y, m2.y)
+	);
+	br = Point(
+		min(store.cols(i) - m1.x, store.cols(j) - m2.x),
+		min(store.rows(i) - m1.y, store.rows(j) - m2.y)
+	);
+}
+
+// Total weight of the overlap [tl, br] (inclusive, relative to the mass centre).
+int overlapWeight(Point tl, Point br) {
+	int area = (br.x - tl.x + 1) * (br.y - tl.y + 1);
+	int x0 = max(tl.x, -maskRadius) + maskRadius, x1 = min(br.x, maskRadius) + maskRadius + 1;
+	int y0 = max(tl.y, -maskRadius) + maskRadius, y1 = min(br.y, maskRadius) + maskRadius + 1;
+	if (x0 >= x1 || y0 >= y1)
+		return area;
+
+	const int *sat = weightPlane.sat;
+	int inside = sat[y1 * satStride + x1] - sat[y0 * satStride + x1]
+	           - sat[y1 * satStride + x0] + sat[y0 * satStride + x0];
+	return area - (x1 - x0) * (y1 - y0) + inside;
+}
+
+
+DistanceStats &DistanceStats::operator+=(const DistanceStats &other) {
+	evaluated    += other.evaluated;
+	sizeRejected += other.sizeRejected;
+	earlyExits   += other.earlyExits;
+	return *this;
+}
+
+
+float computeDistance(const GlyphStore &store, int i, int j) {
+
+	if (sizesDiffer(store, i, j))
+		return 128.0;
+
+	Overlap o(store, i, j);
+	int sum = 0;
+	for (int dy = o.tl.y; dy <= o.br.y; ++dy) {
+		if (Overlap::inWindow(dy))
+			sum += o.windowRowRest(dy) + o.windowRow(dy);
+		else
+			sum += o.plainRow(dy);
+	}
+
+	return (float)sum / overlapWeight(o.tl, o.br);
+}
+
+bool distanceBelow(const GlyphStore &store, int i, int j, float threshold, DistanceStats *stats) {
+
+	if (stats)
+		++stats->evaluated;
+
+	if (sizesDiffer(store, i, j)) {
+		if (stats)
+			++stats->sizeRejected;
+		return 128.0 < threshold;
+	}
+
+	Overlap o(store, i, j);
+	const int weights = overlapWeight(o.tl, o.br);
+
+	// The partial sum only grows and float division is monotonic, so once the
+	// partial distance reaches the threshold the full one cannot be below it.
+	// Heavily weighted window rows go first so that mismatches show up early.
+	int sum = 0;
+	auto exceeds = [&](int part) {
+		sum += part;
+		return (float)sum / weights >= threshold;
+	};
+
+	const int wy0 = max(o.tl.y, -maskRadius), wy1 = min(o.br.y, maskRadius);
+	for (int dy = wy0; dy <= wy1; ++dy) {
+		if (exceeds(o.windowRow(dy)))
+			return earlyExit(stats);
+	}
+
+	for (int dy = o.tl.y; dy <= o.br.y; ++dy) {
+		if (exceeds(Overlap::inWindow(dy) ? o.windowRowRest(dy) : o.plainRow(dy)))
+			return dy < o.br.y ? earlyExit(stats) : false;
+	}
+
+	return true;
+}
+
+const char *distanceKernelName() {
+	return kernels.name;
+}
@@ -0,0 +1,47 @@
+#ifndef DISTANCE_H
+#define DISTANCE_H
+
+#include <cstdlib>
+
+#include "glyphstore.h"
+
+// Weighted mean absolute difference of glyphs i and j aligned on their mass
+// centres. Pixels inside the 31x31 window around the centre are weighted by
+// weightsMask + weightsMask2 (mask.h), all others by 1. Pairs whose sizes
+// differ by more than 5 pixels get the maximal distance of 128.
+//
+// The overlap scanned reaches one pixel past the right and bottom edge of
+// the crop, into the white border GlyphStore keeps there.
+float computeDistance(const GlyphStore &store, int i, int j);
+
+// Glyphs whose width or height differ by more than this are never compared
+const int maxSizeDiff = 5;
+
+inline bool sizesDiffer(const GlyphStore &store, int i, int j) {
+	return std::abs(store.cols(i) - store.cols(j)) > maxSizeDiff || std::abs(store.rows(i) - store.rows(j)) > maxSizeDiff;
+}
+
+// Overlap scanned by computeDistance, as inclusive offsets from the mass centres.
+void overlapBounds(const GlyphStore &store, int i, int j, cv::Point &tl, cv::Point &br);
+
+// Total weight of such an overlap, i.e. the divisor of computeDistance. Every
+// single weight is at least 1.
+int overlapWeight(cv::Point tl, cv::Point br);
+
+// Counters collected by distanceBelow.
+struct DistanceStats {
+	DistanceStats &operator+=(const DistanceStats &other);
+
+	unsigned long long evaluated    = 0;   // calls
+	unsigned long long sizeRejected = 0;   // pairs rejected by the size check
+	unsigned long long earlyExits   = 0;   // pairs rejected before the whole overlap was scanned
+};
+
+// Same as computeDistance(store, i, j) < threshold, but gives up as soon as the
+// weighted sum seen so far can no longer end up under the threshold.
+bool distanceBelow(const GlyphStore &store, int i, int j, float threshold, DistanceStats *stats = nullptr);
+
+// Name of the row kernel picked for this CPU: "avx2", "sse2" or "scalar".
+const char *distanceKernelName();
+
+#endif // DISTANCE_H
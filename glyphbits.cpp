@@ -0,0 +1,215 @@
+#include <algorithm>
+
+#include "distance.h"
+#include "glyphbits.h"
+#include "mask.h"
+
+// The popcount scan is compiled a second time for CPUs with the instruction
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GLYPHBITS_POPCNT
+#endif
+
+using namespace std;
+using namespace cv;
+
+
+namespace {
+
+// Pixels up to darkMax are dark, from lightMin on light; a dark and a light
+// one differ by at least classGap
+const int darkMax  = 63;
+const int lightMin = 192;
+const int classGap = lightMin - darkMax;
+
+const int maskRadius  = 15;
+const int maskSize    = 2 * maskRadius + 1;
+const int extraPlanes = 3;
+
+// Bit of word 0 the mass centre falls on, so that glyphs up to 64 pixels
+// wide usually take one word per row and the window always lies in word 0
+const int centreBit = 32;
+
+static_assert(centreBit >= maskRadius && centreBit + maskRadius < 64, "the window must lie in word 0");
+
+// Word holding column c (relative to the mass centre) and its bit there
+int wordOf(int c) {
+	c += centreBit;
+	return c >= 0 ? c / 64 : -((63 - c) / 64);
+}
+
+int bitOf(int c) {
+	return c + centreBit - 64 * wordOf(c);
+}
+
+// weightsMask + weightsMask2 - 1 as bit planes of word 0 for the rows of
+// the window. Weight 1 is the plain popcount.
+struct ExtraWeights {
+	uint64_t bits[maskSize][extraPlanes];
+};
+
+constexpr ExtraWeights makeExtraWeights() {
+	ExtraWeights e{};
+	for (int y = 0; y < maskSize; ++y) {
+		for (int x = 0; x < maskSize; ++x) {
+			const int extra = weightsMask[y][x] + weightsMask2[y][x] - 1;
+			for (int k = 0; k < extraPlanes; ++k) {
+				if (extra >> k & 1)
+					e.bits[y][k] |= uint64_t(1) << (x - maskRadius + centreBit);
+			}
+		}
+	}
+	return e;
+}
+
+constexpr ExtraWeights extraWeights = makeExtraWeights();
+
+constexpr int maxWeight() {
+	int res = 0;
+	for (int y = 0; y < maskSize; ++y)
+		for (int x = 0; x < maskSize; ++x)
+			res = weightsMask[y][x] + weightsMask2[y][x] > res ? weightsMask[y][x] + weightsMask2[y][x] : res;
+	return res;
+}
+
+static_assert(maxWeight() - 1 < (1 << extraPlanes), "weights do not fit the extra bit planes");
+
+// Dark and light words of the rows of two glyphs, interleaved, from word k0 on
+struct RowScan {
+	const uint64_t *r1, *r2;     // row dy0
+	ptrdiff_t stride1, stride2;
+	int dy0, dy1;                // rows relative to the mass centre, inclusive
+	int k0, n;                   // first word and number of words
+	int enough;                  // weighted count that proves the pair apart
+};
+
+__attribute__((always_inline)) inline uint64_t mismatches(const RowScan &s, int dy, int k) {
+	const uint64_t *a = s.r1 + (dy - s.dy0) * s.stride1 + 2 * k, *b = s.r2 + (dy - s.dy0) * s.stride2 + 2 * k;
+	return (a[0] & b[1]) | (a[1] & b[0]);
+}
+
+// As in distanceBelow the heavily weighted window rows go first, then the
+// rest counts once per mismatch
+__attribute__((always_inline)) inline bool scanApart(const RowScan &s) {
+	const int  centre    = -s.k0;
+	const bool hasCentre = centre >= 0 && centre < s.n;
+	const int  wy0 = max(s.dy0, -maskRadius), wy1 = min(s.dy1, maskRadius);
+	int sum = 0;
+
+	if (hasCentre) {
+		for (int dy = wy0; dy <= wy1; ++dy) {
+			const uint64_t mismatch = mismatches(s, dy, centre);
+			const uint64_t *extra   = extraWeights.bits[dy + maskRadius];
+			sum += __builtin_popcountll(mismatch);
+			for (int p = 0; p < extraPlanes; ++p)
+				sum += __builtin_popcountll(mismatch & extra[p]) << p;
+			if (sum >= s.enough)
+				return true;
+		}
+	}
+
+	for (int dy = s.dy0; dy <= s.dy1; ++dy) {
+		const bool window = hasCentre && dy >= wy0 && dy <= wy1;
+		for (int k = 0; k < s.n; ++k) {
+			if (!window || k != centre)
+				sum += __builtin_popcountll(mismatches(s, dy, k));
+		}
+		if (sum >= s.enough)
+			return true;
+	}
+	return false;
+}
+
+bool scanApartDefault(const RowScan &s) {
+	return scanApart(s);
+}
+
+#ifdef GLYPHBITS_POPCNT
+
+__attribute__((target("popcnt")))
+bool scanApartPopcnt(const RowScan &s) {
+	return scanApart(s);
+}
+
+#endif // GLYPHBITS_POPCNT
+
+typedef bool (*ScanFunction)(const RowScan &);
+
+ScanFunction selectScan() {
+#ifdef GLYPHBITS_POPCNT
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("popcnt"))
+		return scanApartPopcnt;
+#endif
+	return scanApartDefault;
+}
+
+const ScanFunction scan = selectScan();
+
+} // namespace
+
+
+GlyphBits::GlyphBits(const GlyphStore &store) : GlyphBits(store, vector<char>(store.size(), 1)) { }
+
+GlyphBits::GlyphBits(const GlyphStore &store, const vector<char> &selected) : store(store) {
+
+	const int n = store.size();
+	offsets.reserve(n);
+	firstWords.reserve(n);
+	rowWords.reserve(n);
+
+	for (int i = 0; i < n; ++i) {
+		const int cx    = store.massCentre(i).x;
+		const int first = wordOf(-cx), last = wordOf(store.cols(i) - 1 - cx);
+		const int count = selected[i] ? max(last - first + 1, 0) : 0;
+
+		offsets.push_back(words.size());
+		firstWords.push_back(first);
+		rowWords.push_back(count);
+		words.resize(words.size() + 2 * (size_t)count * store.rows(i), 0);
+
+		uint64_t *row = words.data() + offsets.back();
+		for (int y = 0; y < store.rows(i); ++y, row += 2 * count) {
+			const uchar *pixels = store.pixel(i, y, 0);
+			for (int x = 0; x < store.cols(i); ++x) {
+				const int c = x - cx, k = wordOf(c) - first;
+				if (pixels[x] <= darkMax)
+					row[2 * k]     |= uint64_t(1) << bitOf(c);
+				else if (pixels[x] >= lightMin)
+					row[2 * k + 1] |= uint64_t(1) << bitOf(c);
+			}
+		}
+	}
+}
+
+bool GlyphBits::apart(int i, int j, float threshold) const {
+
+	Point tl, br;
+	overlapBounds(store, i, j, tl, br);
+
+	// Only pixels inside both crops are classified: the overlap without its
+	// bottom row, and the words both glyphs have
+	const int k0 = max(firstWords[i], firstWords[j]);
+	const int k1 = min(firstWords[i] + rowWords[i], firstWords[j] + rowWords[j]);
+	if (k0 >= k1 || tl.y >= br.y)
+		return false;
+
+	const Point m1 = store.massCentre(i), m2 = store.massCentre(j);
+	RowScan s;
+	s.stride1 = 2 * rowWords[i];
+	s.stride2 = 2 * rowWords[j];
+	s.r1      = words.data() + offsets[i] + (tl.y + m1.y) * s.stride1 + 2 * (k0 - firstWords[i]);
+	s.r2      = words.data() + offsets[j] + (tl.y + m2.y) * s.stride2 + 2 * (k0 - firstWords[j]);
+	s.dy0     = tl.y;
+	s.dy1     = br.y - 1;
+	s.k0      = k0;
+	s.n       = k1 - k0;
+
+	// Smallest count whose lower bound classGap * count reaches the threshold
+	// as computeDistance compares it
+	const int weights = overlapWeight(tl, br);
+	s.enough = max((int)(threshold * weights / classGap) - 1, 0);
+	while ((float)(classGap * s.enough) / weights < threshold)
+		++s.enough;
+
+	return scan(s);
+}
@@ -0,0 +1,41 @@
+#ifndef GLYPHBITS_H
+#define GLYPHBITS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "glyphstore.h"
+
+// Binarized copies of the glyphs in a store: one bit plane of clearly dark
+// and one of clearly light pixels, packed into 64 bit words per row. Words
+// are aligned on the mass centre, so word k of every glyph covers the same
+// columns relative to it and two glyphs are compared word by word. A pixel
+// costs two bits of each glyph plus the weight planes where computeDistance
+// reads bytes, so a pair takes a quarter of its memory traffic at best;
+// whether that beats the vectorised byte kernels depends on the glyph sizes
+// and on how much of the store fits in the caches, so it is optional.
+class GlyphBits {
+public:
+	explicit GlyphBits(const GlyphStore &store);
+
+	// Only binarizes the glyphs i with selected[i]; apart is false for pairs
+	// with any other glyph
+	GlyphBits(const GlyphStore &store, const std::vector<char> &selected);
+
+	// True if the pixels that are dark in one glyph and light in the other
+	// alone prove computeDistance(store, i, j) >= threshold. Each of them
+	// adds at least the gap between the two classes times its weight; the
+	// weights are split into bit planes so that a row costs a few popcounts.
+	bool apart(int i, int j, float threshold) const;
+
+private:
+	const GlyphStore &store;
+
+	std::vector<size_t>   offsets;      // of the first row of each glyph
+	std::vector<int>      firstWords;   // word of the leftmost column
+	std::vector<int>      rowWords;     // words per row
+	std::vector<uint64_t> words;        // per row and word: dark bits, light bits
+};
+
+#endif // GLYPHBITS_H
@@ -0,0 +1,232 @@
+#include <cstring>
+#include <iostream>
+#include <utility>
+
+#include <boost/filesystem/fstream.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+
+#include "binaryio.h"
+#include "glyphcache.h"
+
+namespace fs  = boost::filesystem;
+namespace bip = boost::interprocess;
+
+using namespace std;
+using namespace cv;
+
+
+namespace {
+
+const char cacheMagic[8] = { 'G', 'L', 'Y', 'P', 'H', 'S', '0', '1' };
+
+struct Header {
+	char     magic[8];
+	uint32_t count;
+	uint32_t entrySize;      // guards against layout changes
+	uint64_t namesOffset;
+	uint64_t pixelsOffset;
+	uint64_t totalSize;
+};
+
+// Glyphs start on 16 byte boundaries, the blob on a 64 byte one
+uint64_t alignUp(uint64_t offset, uint64_t alignment) {
+	return (offset + alignment - 1) / alignment * alignment;
+}
+
+} // namespace
+
+
+struct GlyphCache::Entry {
+	uint64_t pixels;         // offset of the first pixel within the blob
+	uint64_t fileSize;
+	int64_t  fileTime;
+	uint32_t name, nameLength;
+	int32_t  cols, rows;     // of the crop; the blob holds one more of each
+	int32_t  step;
+	int32_t  massX, massY;
+	int32_t  reserved;
+};
+
+
+bool GlyphCache::open(const fs::path &file) {
+
+	boost::system::error_code error;
+	if (!fs::is_regular_file(file, error))
+		return false;
+
+	try {
+		bip::file_mapping mapping(file.string().c_str(), bip::read_only);
+		region.reset(new bip::mapped_region(mapping, bip::read_only));
+	} catch (const bip::interprocess_exception &e) {
+		cerr << "Could not map glyph cache \"" << file.string() << "\": " << e.what() << endl;
+		return false;
+	}
+
+	const char *base = static_cast<const char *>(region->get_address());
+	const size_t size = region->get_size();
+
+	index.clear();
+	stored = 0;
+	intact = true;
+	size_t malformed = 0;
+
+	// Segments start on 64 byte boundaries
+	for (uint64_t offset = 0; offset < size; ) {
+		const char *segment = base + offset;
+		const uint64_t left = size - offset;
+		const Header *header = reinterpret_cast<const Header *>(segment);
+
+		bool valid = left >= sizeof(Header) && memcmp(header->magic, cacheMagic, sizeof(cacheMagic)) == 0
+			&& header->entrySize == sizeof(Entry) && header->totalSize <= left
+			&& header->namesOffset >= sizeof(Header) + (uint64_t)header->count * sizeof(Entry)
+			&& header->pixelsOffset >= header->namesOffset && header->pixelsOffset <= header->totalSize;
+
+		vector<pair<string, Slot>> found;
+		for (size_t i = 0; valid && i < header->count; ++i) {
+			const Entry &e = reinterpret_cast<const Entry *>(segment + sizeof(Header))[i];
+
+			// Would not make a glyph with its border, or has its mass centre
+			// outside of it; such images are decoded again
+			if (e.cols <= 0 || e.rows <= 0 || e.step < (int64_t)e.cols + 1
+					|| e.massX < 0 || e.massX >= e.cols || e.massY < 0 || e.massY >= e.rows) {
+				++malformed;
+				continue;
+			}
+
+			const uint64_t blob = header->totalSize - header->pixelsOffset;
+			valid = header->namesOffset + e.name + e.nameLength <= header->pixelsOffset
+				&& e.pixels <= blob && (uint64_t)e.step * ((uint64_t)e.rows + 1) <= blob - e.pixels;
+			if (valid)
+				found.push_back(make_pair(string(segment + header->namesOffset + e.name, e.nameLength),
+				                          Slot{ &e, reinterpret_cast<const uchar *>(segment + header->pixelsOffset) }));
+		}
+
+		if (!valid) {
+			if (offset == 0) {
+				cerr << "Ignoring invalid glyph cache \"" << file.string() << "\"" << endl;
+				index.clear();
+				region.reset();
+				return false;
+			}
+			cerr << "Ignoring the damaged end of glyph cache \"" << file.string() << "\"" << endl;
+			intact = false;
+			break;
+		}
+
+		for (pair<string, Slot> &slot : found)
+			index[move(slot.first)] = slot.second;
+		stored += header->count;
+		offset  = alignUp(offset + header->totalSize, 64);
+	}
+
+	if (malformed > 0)
+		cerr << "Ignoring " << malformed << " malformed entries of glyph cache \"" << file.string() << "\"" << endl;
+
+	return true;
+}
+
+bool GlyphCache::contains(const string &fileName, uintmax_t fileSize, time_t fileTime) const {
+	auto it = index.find(fileName);
+	return it != index.end() && it->second.entry->fileSize == fileSize && it->second.entry->fileTime == fileTime;
+}
+
+bool GlyphCache::find(const string &fileName, uintmax_t fileSize, time_t fileTime,
+                      Mat &glyph, Point &massCentre) const {
+
+	if (!contains(fileName, fileSize, fileTime))
+		return false;
+
+	const Slot &slot = index.find(fileName)->second;
+	const Entry &e = *slot.entry;
+	glyph      = Mat(e.rows, e.cols, CV_8UC1, const_cast<uchar *>(slot.pixels + e.pixels), e.step);
+	massCentre = Point(e.massX, e.massY);
+	return true;
+}
+
+// Offsets in the header are relative to the start of the segment
+bool GlyphCache::writeSegment(ostream &out, const GlyphStore &store, const vector<int> &glyphs) {
+
+	vector<Entry> entries(glyphs.size());
+	string names;
+	uint64_t blobSize = 0;
+
+	for (size_t k = 0; k < glyphs.size(); ++k) {
+		const int i = glyphs[k];
+		const string name = store.fileName(i);
+		Entry &e = entries[k];
+		memset(&e, 0, sizeof(e));
+
+		e.pixels     = blobSize = alignUp(blobSize, 16);
+		e.fileSize   = store.fileSize(i);
+		e.fileTime   = store.fileTime(i);
+		e.name       = names.size();
+		e.nameLength = name.size();
+		e.cols       = store.cols(i);
+		e.rows       = store.rows(i);
+		e.step       = store.cols(i) + 1;
+		e.massX      = store.massCentre(i).x;
+		e.massY      = store.massCentre(i).y;
+
+		names    += name;
+		blobSize += (uint64_t)e.step * (e.rows + 1);
+	}
+
+	Header header;
+	memcpy(header.magic, cacheMagic, sizeof(cacheMagic));
+	header.count        = glyphs.size();
+	header.entrySize    = sizeof(Entry);
+	header.namesOffset  = sizeof(Header) + entries.size() * sizeof(Entry);
+	header.pixelsOffset = alignUp(header.namesOffset + names.size(), 64);
+	header.totalSize    = header.pixelsOffset + blobSize;
+
+	const char zeros[64] = { 0 };
+
+	out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+	out.write(reinterpret_cast<const char *>(entries.data()), entries.size() * sizeof(Entry));
+	out.write(names.data(), names.size());
+	out.write(zeros, header.pixelsOffset - header.namesOffset - names.size());
+
+	uint64_t written = 0;
+	for (size_t k = 0; k < glyphs.size(); ++k) {
+		const int i = glyphs[k];
+		out.write(zeros, entries[k].pixels - written);
+		// The rows include the border pixel on the right and the border row below
+		for (int y = 0; y <= store.rows(i); ++y)
+			out.write(reinterpret_cast<const char *>(store.pixel(i, y, 0)), entries[k].step);
+		written = entries[k].pixels + (uint64_t)entries[k].step * (entries[k].rows + 1);
+	}
+
+	return (bool)out;
+}
+
+bool GlyphCache::write(const fs::path &file, const GlyphStore &store) {
+
+	vector<int> glyphs(store.size());
+	for (int i = 0; i < store.size(); ++i)
+		glyphs[i] = i;
+
+	return replaceFile(file, [&](ostream &out) { writeSegment(out, store, glyphs); });
+}
+
+bool GlyphCache::append(const fs::path &file, const GlyphStore &store) const {
+
+	vector<int> glyphs;
+	for (int i = 0; i < store.size(); ++i) {
+		if (!contains(store.fileName(i), store.fileSize(i), store.fileTime(i)))
+			glyphs.push_back(i);
+	}
+
+	boost::system::error_code error;
+	const uint64_t size = fs::file_size(file, error);
+	if (error)
+		return false;
+
+	// The mapping only covers the segments already there, so it stays valid
+	fs::ofstream out(file, ios::binary | ios::app);
+	const char zeros[64] = { 0 };
+	out.write(zeros, alignUp(size, 64) - size);
+	writeSegment(out, store, glyphs);
+
+	out.close();
+	return (bool)out;
+}
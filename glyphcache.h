@@ -0,0 +1,73 @@
+#ifndef GLYPHCACHE_H
+#define GLYPHCACHE_H
+
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <opencv2/core/core.hpp>
+
+#include "glyphstore.h"
+
+// Preprocessed glyphs of a directory in one file of one or more segments,
+// each with a header, an index entry per glyph (name, size, mass centre, size
+// and mtime of the source file and pixel offset), the names, and one blob
+// with the cropped pixels and the white border computeDistance reads. Later
+// segments hold images added or changed since and win over earlier ones.
+// Segments are only ever appended, so a damaged one can only be the last,
+// left by an append that did not finish; it is ignored on opening, and the
+// file has to be written anew before anything else is appended.
+class GlyphCache {
+public:
+	// Maps the cache; false if the file is missing or not a valid cache
+	bool open(const boost::filesystem::path &file);
+
+	size_t size() const { return index.size(); }
+
+	// Entries in all segments, including those of images changed since
+	size_t entries() const { return stored; }
+
+	// Whether every segment is intact, so that append can add another one
+	bool complete() const { return intact; }
+
+	// Looks up the cached copy of fileName; false if there is none or the
+	// source file has changed since it was cached. glyph points into the
+	// read-only mapping, so it is only valid as long as the cache is open.
+	bool find(const std::string &fileName, uintmax_t fileSize, time_t fileTime,
+	          cv::Mat &glyph, cv::Point &massCentre) const;
+
+	// Whether find would succeed
+	bool contains(const std::string &fileName, uintmax_t fileSize, time_t fileTime) const;
+
+	// Writes the glyphs in store (with fileSize and fileTime set) to file. The
+	// old file is replaced by a rename, so existing mappings of it stay valid.
+	static bool write(const boost::filesystem::path &file, const GlyphStore &store);
+
+	// Adds a segment with the glyphs in store that find would not return to
+	// file, the one this cache was opened from.
+	bool append(const boost::filesystem::path &file, const GlyphStore &store) const;
+
+private:
+	struct Entry;
+
+	// An entry and the blob of its segment
+	struct Slot {
+		const Entry *entry;
+		const uchar *pixels;
+	};
+
+	// Writes glyphs of store as one segment; false on write errors
+	static bool writeSegment(std::ostream &out, const GlyphStore &store, const std::vector<int> &glyphs);
+
+	std::unique_ptr<boost::interprocess::mapped_region> region;
+	std::unordered_map<std::string, Slot> index;
+	size_t stored = 0;
+	bool   intact = false;
+};
+
+#endif // GLYPHCACHE_H
@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <numeric>
+
+#include "glyphstore.h"
+
+using namespace std;
+using namespace cv;
+
+
+namespace {
+
+const size_t glyphAlignment = 64;
+const size_t rowAlignment   = 16;
+
+size_t alignUp(size_t n, size_t alignment) {
+	return (n + alignment - 1) / alignment * alignment;
+}
+
+} // namespace
+
+
+GlyphStore::~GlyphStore() {
+	free(arena);
+}
+
+void GlyphStore::grow(size_t bytes) {
+	if (used + bytes <= capacity)
+		return;
+
+	size_t newCapacity = max(max(2 * capacity, used + bytes), (size_t)1 << 16);
+	void *newArena;
+	if (posix_memalign(&newArena, glyphAlignment, newCapacity) != 0)
+		throw bad_alloc();
+
+	if (used > 0)
+		memcpy(newArena, arena, used);
+	free(arena);
+	arena    = static_cast<uchar *>(newArena);
+	capacity = newCapacity;
+}
+
+void GlyphStore::reserve(size_t count, size_t pixels) {
+	grow(pixels + count * glyphAlignment);
+
+	offsets.reserve(count);
+	widths.reserve(count);
+	heights.reserve(count);
+	steps.reserve(count);
+	centres.reserve(count);
+	nameOffsets.reserve(count);
+	fileSizes.reserve(count);
+	fileTimes.reserve(count);
+}
+
+int GlyphStore::add(const Mat &glyph, Point massCentre, const string &fileName,
+                    uintmax_t fileSize, time_t fileTime) {
+
+	CV_Assert(glyph.empty() || glyph.type() == CV_8UC1);
+
+	const int    step  = alignUp(glyph.cols + 1, rowAlignment);
+	const size_t bytes = alignUp((size_t)step * (glyph.rows + 1), glyphAlignment);
+	grow(bytes);
+
+	// Everything outside of the glyph itself is white
+	uchar *dst = arena + used;
+	memset(dst, 255, bytes);
+	for (int y = 0; y < glyph.rows; ++y)
+		memcpy(dst + (size_t)y * step, glyph.ptr<uchar>(y), glyph.cols);
+
+	offsets.push_back(used);
+	used += bytes;
+
+	widths.push_back(glyph.cols);
+	heights.push_back(glyph.rows);
+	steps.push_back(step);
+	centres.push_back(massCentre);
+	nameOffsets.push_back(names.size());
+	names.insert(names.end(), fileName.begin(), fileName.end());
+	names.push_back('\0');
+	fileSizes.push_back(fileSize);
+	fileTimes.push_back(fileTime);
+
+	return offsets.size() - 1;
+}
+
+Mat GlyphStore::glyph(int i) const {
+	return Mat(heights[i], widths[i], CV_8UC1, const_cast<uchar *>(pixels(i)), steps[i]);
+}
+
+void GlyphStore::sortByName() {
+	vector<int> order(size());
+	iota(order.begin(), order.end(), 0);
+	sort(order.begin(), order.end(), [&](int a, int b) {
+		return strcmp(fileName(a), fileName(b)) < 0;
+	});
+
+	GlyphStore sorted;
+	sorted.reserve(size(), used);
+	for (int i : order)
+		sorted.add(glyph(i), centres[i], fileName(i), fileSizes[i], fileTimes[i]);
+	swap(sorted);
+}
+
+void GlyphStore::swap(GlyphStore &other) {
+	std::swap(arena, other.arena);
+	std::swap(used, other.used);
+	std::swap(capacity, other.capacity);
+	offsets.swap(other.offsets);
+	widths.swap(other.widths);
+	heights.swap(other.heights);
+	steps.swap(other.steps);
+	centres.swap(other.centres);
+	nameOffsets.swap(other.nameOffsets);
+	names.swap(other.names);
+	fileSizes.swap(other.fileSizes);
+	fileTimes.swap(other.fileTimes);
+}
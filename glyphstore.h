@@ -0,0 +1,72 @@
+#ifndef GLYPHSTORE_H
+#define GLYPHSTORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include <opencv2/core/core.hpp>
+
+// The preprocessed glyphs of a run, addressed by index. All pixels live in
+// one arena: every glyph starts on a 64 byte boundary and its rows are
+// padded to a multiple of 16 bytes, with at least one white column on the
+// right and one white row below, which computeDistance reads. Sizes, mass
+// centres, names and source file stamps are kept in parallel arrays.
+class GlyphStore {
+public:
+	GlyphStore() = default;
+	GlyphStore(const GlyphStore &) = delete;
+	GlyphStore &operator=(const GlyphStore &) = delete;
+	~GlyphStore();
+
+	// Reserves room for count glyphs of about pixels pixels in total
+	void reserve(size_t count, size_t pixels);
+
+	// Appends a copy of glyph (8 bit, may be empty, not from this store) and
+	// returns its index. Pointers into the arena are invalidated.
+	int add(const cv::Mat &glyph, cv::Point massCentre, const std::string &fileName,
+	        uintmax_t fileSize = 0, time_t fileTime = 0);
+
+	// Reorders the glyphs by file name
+	void sortByName();
+
+	void swap(GlyphStore &other);
+
+	int size() const { return offsets.size(); }
+
+	// Bytes taken by the arena
+	size_t arenaSize() const { return used; }
+
+	int cols(int i) const { return widths[i]; }
+	int rows(int i) const { return heights[i]; }
+	int step(int i) const { return steps[i]; }
+	const uchar *pixels(int i) const { return arena + offsets[i]; }
+	const uchar *pixel(int i, int y, int x) const { return pixels(i) + (ptrdiff_t)y * steps[i] + x; }
+	cv::Point massCentre(int i) const { return centres[i]; }
+
+	// Header of glyph i that shares the arena
+	cv::Mat glyph(int i) const;
+
+	const char *fileName(int i) const { return names.data() + nameOffsets[i]; }
+	uintmax_t fileSize(int i) const { return fileSizes[i]; }
+	time_t fileTime(int i) const { return fileTimes[i]; }
+
+private:
+	void grow(size_t bytes);
+
+	uchar *arena    = nullptr;
+	size_t used     = 0;
+	size_t capacity = 0;
+
+	std::vector<size_t>    offsets;
+	std::vector<int>       widths, heights, steps;
+	std::vector<cv::Point> centres;
+	std::vector<size_t>    nameOffsets;
+	std::vector<char>      names;       // all of them, '\0' terminated
+	std::vector<uintmax_t> fileSizes;
+	std::vector<time_t>    fileTimes;
+};
+
+#endif // GLYPHSTORE_H
@@ -0,0 +1,333 @@
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <boost/filesystem/fstream.hpp>
+
+#include "binaryio.h"
+#include "candidates.h"
+#include "distance.h"
+#include "glyphbits.h"
+#include "incremental.h"
+#include "unionfind.h"
+
+namespace fs = boost::filesystem;
+
+using namespace std;
+
+
+namespace {
+
+const char modelMagic[8] = { 'G', 'L', 'Y', 'P', 'H', 'C', 'M', '2' };
+
+// Members a representative is chosen from
+const size_t medoidSample = 32;
+
+} // namespace
+
+
+// Layout of a segment: magic, glyph, edge and representative counts, every
+// new name as its length and bytes, the edges as glyph index pairs, then the
+// representatives listed. Indices count the glyphs of all segments.
+bool ClusterModel::writeSegment(ostream &out, size_t firstGlyph, const vector<pair<int, int>> &edges,
+                                const vector<int> &listed) const {
+
+	out.write(modelMagic, sizeof(modelMagic));
+	writeValue(out, (uint32_t)(names.size() - firstGlyph));
+	writeValue(out, (uint32_t)edges.size());
+	writeValue(out, (uint32_t)listed.size());
+
+	for (size_t i = firstGlyph; i < names.size(); ++i) {
+		writeValue(out, (uint32_t)names[i].size());
+		out.write(names[i].data(), names[i].size());
+	}
+	for (const pair<int, int> &edge : edges) {
+		writeValue(out, (int32_t)edge.first);
+		writeValue(out, (int32_t)edge.second);
+	}
+	for (int representative : listed)
+		writeValue(out, (int32_t)representative);
+
+	return (bool)out;
+}
+
+void ClusterModel::markSaved() {
+	savedGlyphs          = names.size();
+	savedRepresentatives = representatives;
+	intact               = true;
+}
+
+// Every glyph is joined to the representative of its cluster
+bool ClusterModel::save(const fs::path &file) {
+
+	vector<pair<int, int>> edges;
+	for (size_t i = 0; i < names.size(); ++i) {
+		if (representatives[labels[i]] != (int)i)
+			edges.push_back(make_pair(representatives[labels[i]], (int)i));
+	}
+
+	if (!replaceFile(file, [&](ostream &out) { writeSegment(out, 0, edges, representatives); }))
+		return false;
+
+	markSaved();
+	return true;
+}
+
+// New glyphs are joined to the representatives of their clusters, and so are
+// the saved representatives of clusters merged into others. Every cluster
+// that gained glyphs or a new representative is listed again.
+bool ClusterModel::append(const fs::path &file) {
+
+	vector<char> wasRepresentative(names.size(), 0);
+	for (int representative : savedRepresentatives)
+		wasRepresentative[representative] = 1;
+
+	vector<pair<int, int>> edges;
+	vector<char> changed(representatives.size(), 0);
+	for (size_t i = savedGlyphs; i < names.size(); ++i) {
+		changed[labels[i]] = 1;
+		if (representatives[labels[i]] != (int)i)
+			edges.push_back(make_pair(representatives[labels[i]], (int)i));
+	}
+	for (int representative : savedRepresentatives) {
+		const int label = labels[representative];
+		if (representatives[label] != representative) {
+			changed[label] = 1;
+			edges.push_back(make_pair(representatives[label], representative));
+		}
+	}
+
+	vector<int> listed;
+	for (size_t c = 0; c < representatives.size(); ++c) {
+		if (changed[c] || !wasRepresentative[representatives[c]])
+			listed.push_back(representatives[c]);
+	}
+
+	if (savedGlyphs == names.size() && listed.empty())
+		return true;
+
+	fs::ofstream out(file, ios::binary | ios::app);
+	writeSegment(out, savedGlyphs, edges, listed);
+
+	out.close();
+	if (!out)
+		return false;
+
+	markSaved();
+	return true;
+}
+
+// Clusters are the components of the edges of all segments, numbered in
+// order of their first glyph; the representative listed last is theirs.
+bool ClusterModel::load(const fs::path &file) {
+
+	fs::ifstream in(file, ios::binary);
+	vector<pair<int, int>> edges;
+	vector<int> listed;
+	bool damaged = false;
+	names.clear();
+
+	while (in.peek() != char_traits<char>::eof()) {
+		const size_t known = names.size();
+		char magic[sizeof(modelMagic)];
+		uint32_t glyphs, edgeCount, listedCount;
+		bool valid = in.read(magic, sizeof(magic)) && memcmp(magic, modelMagic, sizeof(magic)) == 0
+			&& readValue(in, glyphs) && readValue(in, edgeCount) && readValue(in, listedCount);
+
+		vector<string> added(valid ? glyphs : 0);
+		for (string &name : added) {
+			uint32_t length;
+			if (!(valid = readValue(in, length)))
+				break;
+			name.resize(length);
+			if (!(valid = (bool)in.read(&name[0], length)))
+				break;
+		}
+
+		const size_t total = known + added.size();
+		vector<pair<int, int>> segmentEdges(valid ? edgeCount : 0);
+		for (pair<int, int> &edge : segmentEdges) {
+			int32_t a, b;
+			valid = readValue(in, a) && readValue(in, b) && a >= 0 && b >= 0 && (size_t)a < total && (size_t)b < total;
+			if (!valid)
+				break;
+			edge = make_pair(a, b);
+		}
+
+		vector<int> segmentListed(valid ? listedCount : 0);
+		for (int &representative : segmentListed) {
+			int32_t value;
+			if (!(valid = readValue(in, value) && value >= 0 && (size_t)value < total))
+				break;
+			representative = value;
+		}
+
+		if (!valid) {
+			if (known == 0)
+				return false;
+			damaged = true;
+			break;
+		}
+
+		names.insert(names.end(), added.begin(), added.end());
+		edges.insert(edges.end(), segmentEdges.begin(), segmentEdges.end());
+		listed.insert(listed.end(), segmentListed.begin(), segmentListed.end());
+	}
+
+	if (names.empty())
+		return false;
+
+	ConcurrentUnionFind sets(names.size());
+	for (const pair<int, int> &edge : edges)
+		sets.unite(edge.first, edge.second);
+	const int clusters = sets.components(labels);
+
+	representatives.assign(clusters, -1);
+	for (int representative : listed)
+		representatives[labels[representative]] = representative;
+	if (find(representatives.begin(), representatives.end(), -1) != representatives.end())
+		return false;
+
+	markSaved();
+	intact = !damaged;
+	return true;
+}
+
+
+vector<int> chooseRepresentatives(const GlyphStore &store, const vector<int> &labels,
+                                  int clusters, const vector<int> &keep) {
+
+	vector<vector<int>> sample(clusters);
+	for (size_t i = 0; i < labels.size(); ++i) {
+		if (keep[labels[i]] < 0 && sample[labels[i]].size() < medoidSample)
+			sample[labels[i]].push_back(i);
+	}
+
+	vector<int> res(keep);
+	for (int c = 0; c < clusters; ++c) {
+		if (res[c] >= 0)
+			continue;
+
+		double best = -1;
+		for (int candidate : sample[c]) {
+			double sum = 0;
+			for (int other : sample[c])
+				sum += computeDistance(store, candidate, other);
+			if (best < 0 || sum < best) {
+				best   = sum;
+				res[c] = candidate;
+			}
+		}
+	}
+	return res;
+}
+
+
+int extendClusters(const GlyphStore &store, bool bitPlanes, const vector<int> &added,
+                   float threshold, int threads, vector<int> &labels,
+                   vector<int> &representatives, PartitionStats &stats) {
+
+	const int n = store.size();
+	ConcurrentUnionFind sets(n);
+
+	// Known clusters start out joined under their representatives
+	vector<char> isRepresentative(n, 0);
+	for (int representative : representatives)
+		isRepresentative[representative] = 1;
+	for (int i = 0; i < n; ++i) {
+		if (labels[i] >= 0)
+			sets.unite(i, representatives[labels[i]]);
+	}
+
+	// Profiles and bit planes are only needed in the size cells around the
+	// new glyphs
+	SizeGrid grid(store);
+	vector<vector<int>> around(added.size());
+	vector<char> cellUsed(grid.cells.size(), 0);
+	for (size_t k = 0; k < added.size(); ++k) {
+		around[k] = grid.neighbours(grid.cellOf(store, added[k]));
+		for (int cell : around[k])
+			cellUsed[cell] = 1;
+	}
+
+	vector<unique_ptr<GlyphProfile>> profiles(n);
+	vector<char> nearby(n, 0);
+	for (size_t cell = 0; cell < grid.cells.size(); ++cell) {
+		if (!cellUsed[cell])
+			continue;
+		for (int p = grid.cells[cell].begin; p < grid.cells[cell].end; ++p) {
+			profiles[grid.order[p]].reset(new GlyphProfile(store, grid.order[p]));
+			nearby[grid.order[p]] = 1;
+		}
+	}
+
+	unique_ptr<GlyphBits> bits;
+	if (bitPlanes)
+		bits.reset(new GlyphBits(store, nearby));
+
+	stats.pairs      = (unsigned long long)added.size() * (n - 1);
+	stats.candidates = 0;
+
+	threads = max(1, threads);
+	atomic<size_t> nextGlyph(0);
+	mutex statsLock;
+
+	auto work = [&]() {
+		PairTester tester(store, bits.get(), threshold, stats.sampleEvery);
+		unsigned long long candidates = 0;
+
+		auto compare = [&](int i, int j) {
+			++candidates;
+			if (sets.same(i, j))
+				return;
+			if (tester.close(i, *profiles[i], j, *profiles[j]))
+				sets.unite(i, j);
+		};
+
+		for (size_t k; (k = nextGlyph++) < added.size(); ) {
+			const int i = added[k];
+
+			// Representatives first: once a new glyph has joined a cluster,
+			// the other members of that cluster are skipped
+			for (int pass = 0; pass < 2; ++pass) {
+				for (int cell : around[k]) {
+					for (int p = grid.cells[cell].begin; p < grid.cells[cell].end; ++p) {
+						const int j = grid.order[p];
+						if (j != i && isRepresentative[j] == (pass == 0))
+							compare(i, j);
+					}
+				}
+			}
+		}
+
+		lock_guard<mutex> guard(statsLock);
+		stats.candidates += candidates;
+		tester.addTo(stats);
+	};
+
+	vector<thread> pool;
+	for (int w = 1; w < threads; ++w)
+		pool.emplace_back(work);
+	work();
+	for (thread &t : pool)
+		t.join();
+
+	// Relabel; a cluster that did not take in any new glyph keeps its
+	// representative, the others get a new one
+	int number = sets.components(labels);
+
+	vector<int> keep(number, -1);
+	vector<char> changed(number, 0);
+	for (int i : added)
+		changed[labels[i]] = 1;
+	for (int representative : representatives) {
+		if (!changed[labels[representative]])
+			keep[labels[representative]] = representative;
+	}
+
+	representatives = chooseRepresentatives(store, labels, number, keep);
+	return number;
+}
@@ -0,0 +1,66 @@
+#ifndef INCREMENTAL_H
+#define INCREMENTAL_H
+
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "cluster.h"
+#include "glyphstore.h"
+
+// Clusters saved between incremental runs. The glyphs themselves are kept
+// in a GlyphCache next to it. The file is a series of segments, each with
+// the glyphs added since the one before, edges joining them to the glyphs
+// they were clustered with, and the representatives of the clusters that
+// changed. A damaged last segment is treated as in GlyphCache.
+class ClusterModel {
+public:
+	bool load(const boost::filesystem::path &file);
+
+	// Replaces file with the whole model
+	bool save(const boost::filesystem::path &file);
+
+	// Adds a segment to file, as last loaded or saved, with the glyphs added
+	// to names since and the clusters they changed. Only glyphs may be added
+	// in between, and clusters only merged.
+	bool append(const boost::filesystem::path &file);
+
+	// Whether every segment is intact, so that append can add another one
+	bool complete() const { return intact; }
+
+	std::vector<std::string> names;             // glyph file names, by index
+	std::vector<int>         labels;            // cluster of every glyph
+	std::vector<int>         representatives;   // one glyph index per cluster
+
+private:
+	bool writeSegment(std::ostream &out, size_t firstGlyph, const std::vector<std::pair<int, int>> &edges,
+	                  const std::vector<int> &listed) const;
+	void markSaved();
+
+	size_t           savedGlyphs = 0;
+	std::vector<int> savedRepresentatives;
+	bool             intact = false;
+};
+
+// One representative per cluster: the medoid of (at most the first 32 of)
+// its members. Clusters with keep[label] >= 0 keep that representative.
+std::vector<int> chooseRepresentatives(const GlyphStore &store, const std::vector<int> &labels,
+                                       int clusters, const std::vector<int> &keep);
+
+// Extends a threshold single-linkage clustering by the glyphs listed in
+// added, whose labels are -1 on entry; the others' labels are their clusters
+// so far. Every new glyph is compared with the representatives of clusters
+// in nearby size cells first and then with the remaining nearby glyphs
+// (filtered as in partitionParallel), and merges every cluster it comes
+// closer than threshold to. The result equals partitionParallel over the
+// whole store, labelled the same way. Representatives of untouched clusters
+// are kept. With bitPlanes, GlyphBits of the glyphs in those cells filter
+// the pairs too. Returns the number of clusters.
+int extendClusters(const GlyphStore &store, bool bitPlanes, const std::vector<int> &added,
+                   float threshold, int threads, std::vector<int> &labels,
+                   std::vector<int> &representatives, PartitionStats &stats);
+
+#endif // INCREMENTAL_H
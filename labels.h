@@ -1,11 +0,0 @@
-#ifndef LABELS_H
-#define LABELS_H
-
-#include <map>
-#include <algorithm>
-#include <string>
-
-std::map<std::string, int> labels {{"0.png",	257}, {"1.png",	35}, {"10.png",	140}, {"100.png",	274}, {"1000.png",	80}, {"1001.png",	103}, {"1002.png",	267}, {"1003.png",	41}, {"1004.png",	50}, {"1005.png",	200}, {"1006.png",	87}, {"1007.png",	178}, {"1008.png",	34}, {"1009.png",	31}, {"101.png",	179}, {"1010.png",	157}, {"1011.png",	140}, {"1012.png",	31}, {"1013.png",	150}, {"1014.png",	313}, {"1015.png",	179}, {"1016.png",	35}, {"1017.png",	307}, {"1018.png",	150}, {"1019.png",	157}, {"102.png",	103}, {"1020.png",	87}, {"1021.png",	80}, {"1022.png",	68}, {"1023.png",	41}, {"1024.png",	118}, {"1025.png",	245}, {"1026.png",	121}, {"1027.png",	68}, {"1028.png",	68}, {"1029.png",	68}, {"103.png",	130}, {"1030.png",	40}, {"1031.png",	118}, {"1032.png",	326}, {"1033.png",	157}, {"1034.png",	40}, {"1035.png",	253}, {"1036.png",	150}, {"1037.png",	157}, {"1038.png",	87}, {"1039.png",	157}, {"104.png",	315}, {"1040.png",	278}, {"1041.png",	80}, {"1042.png",	41}, {"1043.png",	80}, {"1044.png",	273}, {"1045.png",	157}, {"1046.png",	130}, {"1047.png",	157}, {"1048.png",	87}, {"1049.png",	307}, {"105.png",	80}, {"1050.png",	40}, {"1051.png",	150}, {"1052.png",	30}, {"1053.png",	140}, {"1054.png",	115}, {"1055.png",	267}, {"1056.png",	140}, {"1057.png",	140}, {"1058.png",	70}, {"1059.png",	80}, {"106.png",	228}, {"1060.png",	13}, {"1061.png",	194}, {"1062.png",	213}, {"1063.png",	115}, {"1064.png",	35}, {"1065.png",	103}, {"1066.png",	267}, {"1067.png",	40}, {"1068.png",	145}, {"1069.png",	77}, {"107.png",	115}, {"1070.png",	150}, {"1071.png",	68}, {"1072.png",	148}, {"1073.png",	274}, {"1074.png",	68}, {"1075.png",	266}, {"1076.png",	122}, {"1077.png",	253}, {"1078.png",	80}, {"1079.png",	130}, {"108.png",	80}, {"1080.png",	122}, {"1081.png",	115}, {"1082.png",	102}, {"1083.png",	140}, {"1084.png",	274}, {"1085.png",	267}, {"1086.png",	150}, {"1087.png",	140}, {"1088.png",	0}, {"1089.png",	307}, {"109.png",	178}, {"1090.png",	231}, {"1091.png",	66}, {"1092.png",	103}, {"1093.png",	157}, {"1094.png",	35}, {"1095.png",	68}, {"1096.png",	87}, {"1097.png",	228}, {"1098.png",	178}, {"1099.png",	194}, {"11.png",	41}, {"110.png",	157}, {"1100.png",	52}, {"1101.png",	228}, {"1102.png",	269}, {"1103.png",	35}, {"1104.png",	191}, {"1105.png",	274}, {"1106.png",	35}, {"1107.png",	115}, {"1108.png",	40}, {"1109.png",	80}, {"111.png",	80}, {"1110.png",	130}, {"1111.png",	103}, {"1112.png",	87}, {"1113.png",	21}, {"1114.png",	87}, {"1115.png",	35}, {"1116.png",	274}, {"1117.png",	122}, {"1118.png",	31}, {"1119.png",	178}, {"112.png",	66}, {"1120.png",	157}, {"1121.png",	87}, {"1122.png",	245}, {"1123.png",	68}, {"1124.png",	177}, {"1125.png",	228}, {"1126.png",	68}, {"1127.png",	228}, {"1128.png",	87}, {"1129.png",	121}, {"113.png",	41}, {"1130.png",	150}, {"1131.png",	13}, {"1132.png",	80}, {"1133.png",	41}, {"1134.png",	41}, {"1135.png",	274}, {"1136.png",	274}, {"1137.png",	34}, {"1138.png",	280}, {"1139.png",	87}, {"114.png",	179}, {"1140.png",	35}, {"1141.png",	274}, {"1142.png",	40}, {"1143.png",	274}, {"1144.png",	41}, {"1145.png",	141}, {"1146.png",	103}, {"1147.png",	178}, {"1148.png",	74}, {"1149.png",	157}, {"115.png",	87}, {"1150.png",	253}, {"1151.png",	122}, {"1152.png",	35}, {"1153.png",	157}, {"1154.png",	68}, {"1155.png",	87}, {"1156.png",	315}, {"1157.png",	267}, {"1158.png",	35}, {"1159.png",	60}, {"116.png",	113}, {"1160.png",	41}, {"1161.png",	274}, {"1162.png",	179}, {"1163.png",	257}, {"1164.png",	87}, {"1165.png",	41}, {"1166.png",	245}, {"1167.png",	140}, {"1168.png",	68}, {"1169.png",	267}, {"117.png",	103}, {"1170.png",	41}, {"1171.png",	87}, {"1172.png",	115}, {"1173.png",	31}, {"1174.png",	41}, {"1175.png",	157}, {"1176.png",	68}, {"1177.png",	140}, {"1178.png",	121}, {"1179.png",	257}, {"118.png",	130}, {"1180.png",	122}, {"1181.png",	31}, {"1182.png",	267}, {"1183.png",	179}, {"1184.png",	228}, {"1185.png",	157}, {"1186.png",	41}, {"1187.png",	122}, {"1188.png",	80}, {"1189.png",	35}, {"119.png",	140}, {"1190.png",	81}, {"1191.png",	253}, {"1192.png",	31}, {"1193.png",	140}, {"1194.png",	68}, {"1195.png",	238}, {"1196.png",	41}, {"1197.png",	41}, {"1198.png",	75}, {"1199.png",	266}, {"12.png",	113}, {"120.png",	253}, {"1200.png",	121}, {"1201.png",	121}, {"1202.png",	300}, {"1203.png",	115}, {"1204.png",	245}, {"1205.png",	267}, {"1206.png",	157}, {"1207.png",	267}, {"1208.png",	41}, {"1209.png",	300}, {"121.png",	66}, {"1210.png",	319}, {"1211.png",	178}, {"1212.png",	80}, {"1213.png",	267}, {"1214.png",	219}, {"1215.png",	35}, {"1216.png",	179}, {"1217.png",	1}, {"1218.png",	54}, {"1219.png",	150}, {"122.png",	115}, {"1220.png",	87}, {"1221.png",	41}, {"1222.png",	121}, {"1223.png",	68}, {"1224.png",	228}, {"1225.png",	115}, {"1226.png",	47}, {"1227.png",	28}, {"1228.png",	304}, {"1229.png",	87}, {"123.png",	115}, {"1230.png",	41}, {"1231.png",	150}, {"1232.png",	178}, {"1233.png",	87}, {"1234.png",	304}, {"1235.png",	41}, {"1236.png",	41}, {"1237.png",	228}, {"1238.png",	35}, {"1239.png",	122}, {"124.png",	211}, {"1240.png",	35}, {"1241.png",	134}, {"1242.png",	31}, {"1243.png",	157}, {"1244.png",	157}, {"1245.png",	267}, {"1246.png",	253}, {"1247.png",	130}, {"1248.png",	326}, {"1249.png",	178}, {"125.png",	274}, {"1250.png",	140}, {"1251.png",	213}, {"1252.png",	35}, {"1253.png",	125}, {"1254.png",	41}, {"1255.png",	228}, {"1256.png",	157}, {"1257.png",	115}, {"1258.png",	115}, {"1259.png",	267}, {"126.png",	120}, {"1260.png",	179}, {"1261.png",	228}, {"1262.png",	274}, {"1263.png",	179}, {"1264.png",	68}, {"1265.png",	41}, {"1266.png",	35}, {"1267.png",	267}, {"1268.png",	326}, {"1269.png",	34}, {"127.png",	115}, {"1270.png",	66}, {"1271.png",	41}, {"1272.png",	179}, {"1273.png",	87}, {"1274.png",	178}, {"1275.png",	307}, {"1276.png",	274}, {"1277.png",	35}, {"1278.png",	87}, {"1279.png",	178}, {"128.png",	140}, {"1280.png",	178}, {"1281.png",	307}, {"1282.png",	40}, {"1283.png",	179}, {"1284.png",	115}, {"1285.png",	130}, {"1286.png",	282}, {"1287.png",	87}, {"1288.png",	187}, {"1289.png",	35}, {"129.png",	106}, {"1290.png",	114}, {"1291.png",	1}, {"1292.png",	178}, {"1293.png",	130}, {"1294.png",	115}, {"1295.png",	41}, {"1296.png",	140}, {"1297.png",	274}, {"1298.png",	41}, {"1299.png",	274}, {"13.png",	267}, {"130.png",	319}, {"1300.png",	41}, {"1301.png",	178}, {"1302.png",	267}, {"1303.png",	267}, {"1304.png",	80}, {"1305.png",	304}, {"1306.png",	201}, {"1307.png",	157}, {"1308.png",	274}, {"1309.png",	136}, {"131.png",	16}, {"1310.png",	228}, {"1311.png",	228}, {"1312.png",	115}, {"1313.png",	147}, {"1314.png",	253}, {"1315.png",	66}, {"1316.png",	38}, {"1317.png",	178}, {"1318.png",	17}, {"1319.png",	113}, {"132.png",	87}, {"1320.png",	115}, {"1321.png",	115}, {"1322.png",	121}, {"1323.png",	35}, {"1324.png",	66}, {"1325.png",	157}, {"1326.png",	87}, {"1327.png",	150}, {"1328.png",	87}, {"1329.png",	140}, {"133.png",	115}, {"1330.png",	103}, {"1331.png",	35}, {"1332.png",	326}, {"1333.png",	319}, {"1334.png",	55}, {"1335.png",	157}, {"1336.png",	80}, {"1337.png",	213}, {"1338.png",	178}, {"1339.png",	245}, {"134.png",	253}, {"1340.png",	35}, {"1341.png",	103}, {"1342.png",	80}, {"1343.png",	274}, {"1344.png",	221}, {"1345.png",	24}, {"1346.png",	80}, {"1347.png",	228}, {"1348.png",	80}, {"1349.png",	326}, {"135.png",	23}, {"1350.png",	80}, {"1351.png",	100}, {"1352.png",	41}, {"1353.png",	41}, {"1354.png",	31}, {"1355.png",	41}, {"1356.png",	274}, {"1357.png",	113}, {"1358.png",	157}, {"1359.png",	307}, {"136.png",	41}, {"1360.png",	274}, {"1361.png",	87}, {"1362.png",	40}, {"1363.png",	92}, {"1364.png",	150}, {"1365.png",	150}, {"1366.png",	45}, {"1367.png",	253}, {"1368.png",	122}, {"1369.png",	306}, {"137.png",	13}, {"1370.png",	36}, {"1371.png",	245}, {"1372.png",	179}, {"1373.png",	115}, {"1374.png",	80}, {"1375.png",	304}, {"1376.png",	304}, {"1377.png",	169}, {"1378.png",	326}, {"1379.png",	8}, {"138.png",	130}, {"1380.png",	54}, {"1381.png",	140}, {"1382.png",	157}, {"1383.png",	41}, {"1384.png",	41}, {"1385.png",	267}, {"1386.png",	115}, {"1387.png",	253}, {"1388.png",	267}, {"1389.png",	157}, {"139.png",	41}, {"1390.png",	115}, {"1391.png",	157}, {"1392.png",	140}, {"1393.png",	152}, {"1394.png",	68}, {"1395.png",	306}, {"1396.png",	304}, {"1397.png",	157}, {"1398.png",	267}, {"1399.png",	157}, {"14.png",	179}, {"140.png",	178}, {"1400.png",	78}, {"1401.png",	41}, {"1402.png",	245}, {"1403.png",	326}, {"1404.png",	115}, {"1405.png",	68}, {"1406.png",	8}, {"1407.png",	83}, {"1408.png",	245}, {"1409.png",	130}, {"141.png",	35}, {"1410.png",	140}, {"1411.png",	150}, {"1412.png",	87}, {"1413.png",	287}, {"1414.png",	115}, {"1415.png",	274}, {"1416.png",	87}, {"1417.png",	280}, {"1418.png",	130}, {"1419.png",	41}, {"142.png",	267}, {"1420.png",	8}, {"1421.png",	87}, {"1422.png",	41}, {"1423.png",	157}, {"1424.png",	34}, {"1425.png",	245}, {"1426.png",	250}, {"1427.png",	41}, {"1428.png",	299}, {"1429.png",	87}, {"143.png",	256}, {"1430.png",	122}, {"1431.png",	122}, {"1432.png",	118}, {"1433.png",	121}, {"1434.png",	150}, {"1435.png",	152}, {"1436.png",	134}, {"1437.png",	140}, {"1438.png",	145}, {"1439.png",	34}, {"144.png",	115}, {"1440.png",	41}, {"1441.png",	130}, {"1442.png",	307}, {"1443.png",	122}, {"1444.png",	157}, {"1445.png",	87}, {"1446.png",	150}, {"1447.png",	41}, {"1448.png",	269}, {"1449.png",	68}, {"145.png",	68}, {"1450.png",	178}, {"1451.png",	140}, {"1452.png",	245}, {"1453.png",	140}, {"1454.png",	85}, {"1455.png",	87}, {"1456.png",	40}, {"1457.png",	150}, {"1458.png",	123}, {"1459.png",	115}, {"146.png",	31}, {"1460.png",	157}, {"1461.png",	157}, {"1462.png",	267}, {"1463.png",	31}, {"1464.png",	130}, {"1465.png",	115}, {"1466.png",	41}, {"1467.png",	274}, {"1468.png",	194}, {"1469.png",	122}, {"147.png",	122}, {"1470.png",	228}, {"1471.png",	257}, {"1472.png",	228}, {"1473.png",	93}, {"1474.png",	108}, {"1475.png",	41}, {"1476.png",	140}, {"1477.png",	267}, {"1478.png",	157}, {"1479.png",	87}, {"148.png",	35}, {"1480.png",	87}, {"1481.png",	35}, {"1482.png",	41}, {"1483.png",	103}, {"1484.png",	150}, {"1485.png",	24}, {"1486.png",	66}, {"1487.png",	68}, {"1488.png",	68}, {"1489.png",	325}, {"149.png",	35}, {"1490.png",	157}, {"1491.png",	157}, {"1492.png",	140}, {"1493.png",	178}, {"1494.png",	266}, {"1495.png",	119}, {"1496.png",	157}, {"1497.png",	87}, {"1498.png",	326}, {"1499.png",	157}, {"15.png",	140}, {"150.png",	258}, {"1500.png",	40}, {"1501.png",	179}, {"1502.png",	40}, {"1503.png",	178}, {"1504.png",	150}, {"1505.png",	40}, {"1506.png",	41}, {"1507.png",	41}, {"1508.png",	194}, {"1509.png",	35}, {"151.png",	140}, {"1510.png",	245}, {"1511.png",	35}, {"1512.png",	140}, {"1513.png",	35}, {"1514.png",	130}, {"1515.png",	115}, {"1516.png",	68}, {"1517.png",	253}, {"1518.png",	178}, {"1519.png",	68}, {"152.png",	295}, {"1520.png",	165}, {"1521.png",	115}, {"1522.png",	150}, {"1523.png",	41}, {"1524.png",	80}, {"1525.png",	122}, {"1526.png",	157}, {"1527.png",	274}, {"1528.png",	267}, {"1529.png",	103}, {"153.png",	87}, {"1530.png",	41}, {"1531.png",	228}, {"1532.png",	41}, {"1533.png",	157}, {"1534.png",	313}, {"1535.png",	274}, {"1536.png",	307}, {"1537.png",	103}, {"1538.png",	24}, {"1539.png",	115}, {"154.png",	41}, {"1540.png",	113}, {"1541.png",	41}, {"1542.png",	304}, {"1543.png",	113}, {"1544.png",	274}, {"1545.png",	310}, {"1546.png",	41}, {"1547.png",	157}, {"1548.png",	94}, {"1549.png",	146}, {"155.png",	232}, {"1550.png",	112}, {"1551.png",	41}, {"1552.png",	178}, {"1553.png",	267}, {"1554.png",	68}, {"1555.png",	253}, {"1556.png",	87}, {"1557.png",	87}, {"1558.png",	157}, {"1559.png",	307}, {"156.png",	274}, {"1560.png",	41}, {"1561.png",	72}, {"1562.png",	11}, {"1563.png",	115}, {"1564.png",	127}, {"1565.png",	130}, {"1566.png",	41}, {"1567.png",	40}, {"1568.png",	1}, {"1569.png",	205}, {"157.png",	40}, {"1570.png",	40}, {"1571.png",	41}, {"1572.png",	87}, {"1573.png",	228}, {"1574.png",	41}, {"1575.png",	87}, {"1576.png",	130}, {"1577.png",	140}, {"1578.png",	41}, {"1579.png",	123}, {"158.png",	140}, {"1580.png",	31}, {"1581.png",	274}, {"1582.png",	157}, {"1583.png",	327}, {"1584.png",	39}, {"1585.png",	115}, {"1586.png",	0}, {"1587.png",	41}, {"1588.png",	307}, {"1589.png",	178}, {"159.png",	267}, {"1590.png",	40}, {"1591.png",	16}, {"1592.png",	274}, {"1593.png",	41}, {"1594.png",	319}, {"1595.png",	282}, {"1596.png",	68}, {"1597.png",	131}, {"1598.png",	228}, {"1599.png",	31}, {"16.png",	157}, {"160.png",	150}, {"1600.png",	267}, {"1601.png",	122}, {"1602.png",	319}, {"1603.png",	203}, {"1604.png",	41}, {"1605.png",	253}, {"1606.png",	103}, {"1607.png",	115}, {"1608.png",	12}, {"1609.png",	130}, {"161.png",	228}, {"1610.png",	54}, {"1611.png",	140}, {"1612.png",	253}, {"1613.png",	271}, {"1614.png",	41}, {"1615.png",	87}, {"1616.png",	306}, {"1617.png",	157}, {"1618.png",	157}, {"1619.png",	150}, {"162.png",	115}, {"1620.png",	179}, {"1621.png",	228}, {"1622.png",	80}, {"1623.png",	228}, {"1624.png",	115}, {"1625.png",	41}, {"1626.png",	87}, {"1627.png",	253}, {"1628.png",	113}, {"1629.png",	245}, {"163.png",	115}, {"1630.png",	66}, {"1631.png",	192}, {"1632.png",	150}, {"1633.png",	140}, {"1634.png",	130}, {"1635.png",	157}, {"1636.png",	41}, {"1637.png",	130}, {"1638.png",	41}, {"1639.png",	130}, {"164.png",	68}, {"1640.png",	245}, {"1641.png",	228}, {"1642.png",	157}, {"1643.png",	41}, {"1644.png",	35}, {"1645.png",	115}, {"1646.png",	299}, {"1647.png",	179}, {"1648.png",	115}, {"1649.png",	41}, {"165.png",	228}, {"1650.png",	157}, {"1651.png",	41}, {"1652.png",	130}, {"1653.png",	68}, {"1654.png",	307}, {"1655.png",	195}, {"1656.png",	65}, {"1657.png",	80}, {"1658.png",	80}, {"1659.png",	216}, {"166.png",	183}, {"1660.png",	63}, {"1661.png",	41}, {"1662.png",	300}, {"1663.png",	57}, {"1664.png",	245}, {"1665.png",	80}, {"1666.png",	41}, {"1667.png",	41}, {"1668.png",	274}, {"1669.png",	40}, {"167.png",	307}, {"1670.png",	68}, {"1671.png",	115}, {"1672.png",	115}, {"1673.png",	87}, {"1674.png",	157}, {"1675.png",	68}, {"1676.png",	27}, {"1677.png",	115}, {"1678.png",	248}, {"1679.png",	253}, {"168.png",	17}, {"1680.png",	265}, {"1681.png",	108}, {"1682.png",	40}, {"1683.png",	41}, {"1684.png",	245}, {"1685.png",	295}, {"1686.png",	35}, {"1687.png",	115}, {"1688.png",	115}, {"1689.png",	40}, {"169.png",	125}, {"1690.png",	122}, {"1691.png",	68}, {"1692.png",	87}, {"1693.png",	40}, {"1694.png",	115}, {"1695.png",	33}, {"1696.png",	103}, {"1697.png",	228}, {"1698.png",	267}, {"1699.png",	38}, {"17.png",	150}, {"170.png",	274}, {"1700.png",	66}, {"1701.png",	267}, {"1702.png",	122}, {"1703.png",	41}, {"1704.png",	31}, {"1705.png",	285}, {"1706.png",	269}, {"1707.png",	179}, {"1708.png",	115}, {"1709.png",	115}, {"171.png",	150}, {"1710.png",	267}, {"1711.png",	253}, {"1712.png",	122}, {"1713.png",	274}, {"1714.png",	228}, {"1715.png",	41}, {"1716.png",	253}, {"1717.png",	80}, {"1718.png",	300}, {"1719.png",	140}, {"172.png",	253}, {"1720.png",	253}, {"1721.png",	87}, {"1722.png",	266}, {"1723.png",	3}, {"1724.png",	178}, {"1725.png",	68}, {"1726.png",	319}, {"1727.png",	121}, {"1728.png",	41}, {"1729.png",	115}, {"173.png",	194}, {"1730.png",	34}, {"1731.png",	130}, {"1732.png",	168}, {"1733.png",	41}, {"1734.png",	35}, {"1735.png",	157}, {"1736.png",	306}, {"1737.png",	38}, {"1738.png",	115}, {"1739.png",	253}, {"174.png",	41}, {"1740.png",	35}, {"1741.png",	267}, {"1742.png",	202}, {"1743.png",	122}, {"1744.png",	253}, {"1745.png",	40}, {"1746.png",	121}, {"1747.png",	103}, {"1748.png",	18}, {"1749.png",	157}, {"175.png",	298}, {"1750.png",	280}, {"1751.png",	157}, {"1752.png",	245}, {"1753.png",	87}, {"1754.png",	40}, {"1755.png",	63}, {"1756.png",	267}, {"1757.png",	157}, {"1758.png",	326}, {"1759.png",	87}, {"176.png",	41}, {"1760.png",	122}, {"1761.png",	150}, {"1762.png",	103}, {"1763.png",	31}, {"1764.png",	113}, {"1765.png",	178}, {"1766.png",	87}, {"1767.png",	178}, {"1768.png",	272}, {"1769.png",	327}, {"177.png",	108}, {"1770.png",	115}, {"1771.png",	87}, {"1772.png",	236}, {"1773.png",	157}, {"1774.png",	304}, {"1775.png",	87}, {"1776.png",	130}, {"1777.png",	157}, {"1778.png",	121}, {"1779.png",	274}, {"178.png",	161}, {"1780.png",	31}, {"1781.png",	280}, {"1782.png",	40}, {"1783.png",	115}, {"1784.png",	150}, {"1785.png",	157}, {"1786.png",	326}, {"1787.png",	274}, {"1788.png",	274}, {"1789.png",	35}, {"179.png",	41}, {"1790.png",	280}, {"1791.png",	267}, {"1792.png",	318}, {"1793.png",	103}, {"1794.png",	115}, {"1795.png",	150}, {"1796.png",	300}, {"1797.png",	304}, {"1798.png",	31}, {"1799.png",	179}, {"18.png",	205}, {"180.png",	66}, {"1800.png",	34}, {"1801.png",	19}, {"1802.png",	41}, {"1803.png",	41}, {"1804.png",	41}, {"1805.png",	68}, {"1806.png",	150}, {"1807.png",	104}, {"1808.png",	253}, {"1809.png",	35}, {"181.png",	115}, {"1810.png",	157}, {"1811.png",	115}, {"1812.png",	35}, {"1813.png",	41}, {"1814.png",	68}, {"1815.png",	253}, {"1816.png",	150}, {"1817.png",	108}, {"1818.png",	87}, {"1819.png",	41}, {"182.png",	243}, {"1820.png",	319}, {"1821.png",	157}, {"1822.png",	87}, {"1823.png",	179}, {"1824.png",	157}, {"1825.png",	274}, {"1826.png",	150}, {"1827.png",	35}, {"1828.png",	121}, {"1829.png",	157}, {"183.png",	87}, {"1830.png",	67}, {"1831.png",	31}, {"1832.png",	140}, {"1833.png",	122}, {"1834.png",	140}, {"1835.png",	122}, {"1836.png",	157}, {"1837.png",	253}, {"1838.png",	179}, {"1839.png",	103}, {"184.png",	87}, {"1840.png",	267}, {"1841.png",	41}, {"1842.png",	228}, {"1843.png",	41}, {"1844.png",	80}, {"1845.png",	138}, {"1846.png",	87}, {"1847.png",	41}, {"1848.png",	144}, {"1849.png",	101}, {"185.png",	87}, {"1850.png",	300}, {"1851.png",	186}, {"1852.png",	115}, {"1853.png",	87}, {"1854.png",	228}, {"1855.png",	326}, {"1856.png",	245}, {"1857.png",	157}, {"1858.png",	130}, {"1859.png",	122}, {"186.png",	40}, {"1860.png",	54}, {"1861.png",	63}, {"1862.png",	68}, {"1863.png",	319}, {"1864.png",	191}, {"1865.png",	194}, {"1866.png",	63}, {"1867.png",	245}, {"1868.png",	66}, {"1869.png",	151}, {"187.png",	231}, {"1870.png",	326}, {"1871.png",	40}, {"1872.png",	87}, {"1873.png",	56}, {"1874.png",	267}, {"1875.png",	80}, {"1876.png",	31}, {"1877.png",	103}, {"1878.png",	122}, {"1879.png",	157}, {"188.png",	245}, {"1880.png",	178}, {"1881.png",	35}, {"1882.png",	41}, {"1883.png",	34}, {"1884.png",	80}, {"1885.png",	267}, {"1886.png",	312}, {"1887.png",	274}, {"1888.png",	87}, {"1889.png",	248}, {"189.png",	319}, {"1890.png",	87}, {"1891.png",	140}, {"1892.png",	115}, {"1893.png",	87}, {"1894.png",	35}, {"1895.png",	82}, {"1896.png",	68}, {"1897.png",	130}, {"1898.png",	68}, {"1899.png",	242}, {"19.png",	121}, {"190.png",	113}, {"1900.png",	87}, {"1901.png",	96}, {"1902.png",	253}, {"1903.png",	267}, {"1904.png",	300}, {"1905.png",	103}, {"1906.png",	168}, {"1907.png",	150}, {"1908.png",	306}, {"1909.png",	22}, {"191.png",	152}, {"1910.png",	253}, {"1911.png",	178}, {"1912.png",	26}, {"1913.png",	66}, {"1914.png",	130}, {"1915.png",	274}, {"1916.png",	115}, {"1917.png",	219}, {"1918.png",	87}, {"1919.png",	157}, {"192.png",	115}, {"1920.png",	87}, {"1921.png",	228}, {"1922.png",	140}, {"1923.png",	87}, {"1924.png",	293}, {"1925.png",	179}, {"1926.png",	34}, {"1927.png",	115}, {"1928.png",	274}, {"1929.png",	253}, {"193.png",	115}, {"1930.png",	80}, {"1931.png",	319}, {"1932.png",	68}, {"1933.png",	179}, {"1934.png",	267}, {"1935.png",	130}, {"1936.png",	122}, {"1937.png",	40}, {"1938.png",	87}, {"1939.png",	68}, {"194.png",	178}, {"1940.png",	87}, {"1941.png",	157}, {"1942.png",	122}, {"1943.png",	63}, {"1944.png",	41}, {"1945.png",	115}, {"1946.png",	245}, {"1947.png",	178}, {"1948.png",	157}, {"1949.png",	70}, {"195.png",	140}, {"1950.png",	87}, {"1951.png",	150}, {"1952.png",	115}, {"1953.png",	304}, {"1954.png",	87}, {"1955.png",	274}, {"1956.png",	274}, {"1957.png",	319}, {"1958.png",	41}, {"1959.png",	304}, {"196.png",	41}, {"1960.png",	41}, {"1961.png",	122}, {"1962.png",	253}, {"1963.png",	24}, {"1964.png",	253}, {"1965.png",	196}, {"1966.png",	181}, {"1967.png",	303}, {"1968.png",	140}, {"1969.png",	115}, {"197.png",	68}, {"1970.png",	122}, {"1971.png",	115}, {"1972.png",	115}, {"1973.png",	87}, {"1974.png",	150}, {"1975.png",	307}, {"1976.png",	219}, {"1977.png",	228}, {"1978.png",	66}, {"1979.png",	115}, {"198.png",	130}, {"1980.png",	306}, {"1981.png",	191}, {"1982.png",	87}, {"1983.png",	140}, {"1984.png",	157}, {"1985.png",	228}, {"1986.png",	41}, {"1987.png",	41}, {"1988.png",	262}, {"1989.png",	267}, {"199.png",	179}, {"1990.png",	41}, {"1991.png",	35}, {"1992.png",	87}, {"1993.png",	87}, {"1994.png",	157}, {"1995.png",	267}, {"1996.png",	157}, {"1997.png",	253}, {"1998.png",	157}, {"1999.png",	121}, {"2.png",	103}, {"20.png",	80}, {"200.png",	130}, {"2000.png",	157}, {"2001.png",	274}, {"2002.png",	87}, {"2003.png",	80}, {"2004.png",	87}, {"2005.png",	152}, {"2006.png",	130}, {"2007.png",	115}, {"2008.png",	205}, {"2009.png",	157}, {"201.png",	115}, {"2010.png",	41}, {"2011.png",	34}, {"2012.png",	115}, {"2013.png",	300}, {"2014.png",	210}, {"2015.png",	80}, {"2016.png",	23}, {"2017.png",	66}, {"2018.png",	253}, {"2019.png",	304}, {"202.png",	24}, {"2020.png",	48}, {"2021.png",	87}, {"2022.png",	234}, {"2023.png",	41}, {"2024.png",	87}, {"2025.png",	157}, {"2026.png",	267}, {"2027.png",	115}, {"2028.png",	140}, {"2029.png",	87}, {"203.png",	122}, {"2030.png",	41}, {"2031.png",	179}, {"2032.png",	41}, {"2033.png",	41}, {"2034.png",	157}, {"2035.png",	306}, {"2036.png",	115}, {"2037.png",	113}, {"2038.png",	245}, {"2039.png",	130}, {"204.png",	267}, {"2040.png",	228}, {"2041.png",	267}, {"2042.png",	115}, {"2043.png",	178}, {"2044.png",	41}, {"2045.png",	123}, {"2046.png",	220}, {"2047.png",	115}, {"2048.png",	326}, {"2049.png",	188}, {"205.png",	228}, {"2050.png",	87}, {"2051.png",	0}, {"2052.png",	241}, {"2053.png",	9}, {"2054.png",	223}, {"2055.png",	35}, {"2056.png",	68}, {"2057.png",	87}, {"2058.png",	291}, {"2059.png",	41}, {"206.png",	157}, {"2060.png",	157}, {"2061.png",	115}, {"2062.png",	41}, {"2063.png",	40}, {"2064.png",	185}, {"2065.png",	80}, {"2066.png",	178}, {"2067.png",	178}, {"2068.png",	179}, {"2069.png",	2}, {"207.png",	179}, {"2070.png",	178}, {"2071.png",	267}, {"2072.png",	253}, {"2073.png",	34}, {"2074.png",	267}, {"2075.png",	157}, {"2076.png",	157}, {"2077.png",	274}, {"2078.png",	150}, {"2079.png",	121}, {"208.png",	80}, {"2080.png",	157}, {"2081.png",	150}, {"2082.png",	245}, {"2083.png",	236}, {"2084.png",	41}, {"2085.png",	68}, {"2086.png",	4}, {"2087.png",	179}, {"2088.png",	87}, {"2089.png",	228}, {"209.png",	267}, {"2090.png",	253}, {"2091.png",	80}, {"2092.png",	157}, {"2093.png",	68}, {"2094.png",	115}, {"2095.png",	179}, {"2096.png",	56}, {"2097.png",	274}, {"2098.png",	253}, {"2099.png",	41}, {"21.png",	253}, {"210.png",	307}, {"2100.png",	113}, {"2101.png",	169}, {"2102.png",	140}, {"2103.png",	115}, {"2104.png",	115}, {"2105.png",	115}, {"2106.png",	142}, {"2107.png",	41}, {"2108.png",	179}, {"2109.png",	267}, {"211.png",	304}, {"2110.png",	14}, {"2111.png",	122}, {"2112.png",	24}, {"2113.png",	115}, {"2114.png",	41}, {"2115.png",	253}, {"2116.png",	253}, {"2117.png",	87}, {"2118.png",	115}, {"2119.png",	113}, {"212.png",	87}, {"2120.png",	150}, {"2121.png",	35}, {"2122.png",	228}, {"2123.png",	227}, {"2124.png",	253}, {"2125.png",	150}, {"2126.png",	95}, {"2127.png",	157}, {"2128.png",	80}, {"2129.png",	181}, {"213.png",	274}, {"2130.png",	115}, {"2131.png",	87}, {"2132.png",	87}, {"2133.png",	80}, {"2134.png",	208}, {"2135.png",	179}, {"2136.png",	306}, {"2137.png",	157}, {"2138.png",	41}, {"2139.png",	80}, {"214.png",	130}, {"2140.png",	274}, {"2141.png",	228}, {"2142.png",	157}, {"2143.png",	35}, {"2144.png",	178}, {"2145.png",	87}, {"2146.png",	304}, {"2147.png",	87}, {"2148.png",	250}, {"2149.png",	35}, {"215.png",	130}, {"2150.png",	140}, {"2151.png",	66}, {"2152.png",	274}, {"2153.png",	103}, {"2154.png",	115}, {"2155.png",	150}, {"2156.png",	35}, {"2157.png",	76}, {"2158.png",	157}, {"2159.png",	130}, {"216.png",	115}, {"2160.png",	157}, {"2161.png",	304}, {"2162.png",	150}, {"2163.png",	14}, {"2164.png",	121}, {"2165.png",	80}, {"2166.png",	213}, {"2167.png",	290}, {"2168.png",	245}, {"2169.png",	157}, {"217.png",	41}, {"2170.png",	274}, {"2171.png",	115}, {"2172.png",	157}, {"2173.png",	41}, {"2174.png",	245}, {"2175.png",	35}, {"2176.png",	130}, {"2177.png",	157}, {"2178.png",	31}, {"2179.png",	274}, {"218.png",	38}, {"2180.png",	122}, {"2181.png",	152}, {"2182.png",	140}, {"2183.png",	41}, {"2184.png",	179}, {"2185.png",	80}, {"2186.png",	41}, {"2187.png",	87}, {"2188.png",	150}, {"2189.png",	41}, {"219.png",	257}, {"2190.png",	157}, {"2191.png",	157}, {"2192.png",	178}, {"2193.png",	41}, {"2194.png",	35}, {"2195.png",	41}, {"2196.png",	245}, {"2197.png",	41}, {"2198.png",	274}, {"2199.png",	245}, {"22.png",	115}, {"220.png",	111}, {"2200.png",	274}, {"2201.png",	164}, {"2202.png",	122}, {"2203.png",	178}, {"2204.png",	130}, {"2205.png",	115}, {"2206.png",	237}, {"2207.png",	40}, {"2208.png",	213}, {"2209.png",	121}, {"221.png",	228}, {"2210.png",	178}, {"2211.png",	121}, {"2212.png",	87}, {"2213.png",	115}, {"2214.png",	108}, {"2215.png",	130}, {"2216.png",	31}, {"2217.png",	121}, {"2218.png",	115}, {"2219.png",	199}, {"222.png",	113}, {"2220.png",	162}, {"2221.png",	41}, {"2222.png",	160}, {"2223.png",	115}, {"2224.png",	268}, {"2225.png",	87}, {"2226.png",	41}, {"2227.png",	157}, {"2228.png",	228}, {"2229.png",	178}, {"223.png",	214}, {"2230.png",	135}, {"2231.png",	157}, {"2232.png",	115}, {"2233.png",	228}, {"2234.png",	307}, {"2235.png",	143}, {"2236.png",	175}, {"2237.png",	87}, {"2238.png",	24}, {"2239.png",	87}, {"224.png",	130}, {"2240.png",	228}, {"2241.png",	41}, {"2242.png",	122}, {"2243.png",	130}, {"2244.png",	80}, {"2245.png",	326}, {"2246.png",	313}, {"2247.png",	267}, {"2248.png",	267}, {"2249.png",	115}, {"225.png",	115}, {"2250.png",	157}, {"2251.png",	24}, {"2252.png",	87}, {"2253.png",	115}, {"2254.png",	276}, {"2255.png",	35}, {"2256.png",	217}, {"2257.png",	157}, {"2258.png",	41}, {"2259.png",	40}, {"226.png",	87}, {"2260.png",	122}, {"2261.png",	292}, {"2262.png",	87}, {"2263.png",	113}, {"2264.png",	68}, {"2265.png",	87}, {"2266.png",	16}, {"2267.png",	122}, {"2268.png",	267}, {"2269.png",	35}, {"227.png",	169}, {"2270.png",	87}, {"2271.png",	157}, {"2272.png",	122}, {"2273.png",	68}, {"2274.png",	274}, {"2275.png",	319}, {"2276.png",	80}, {"2277.png",	122}, {"2278.png",	274}, {"2279.png",	228}, {"228.png",	280}, {"2280.png",	150}, {"2281.png",	307}, {"2282.png",	234}, {"2283.png",	40}, {"2284.png",	157}, {"2285.png",	140}, {"2286.png",	267}, {"2287.png",	7}, {"2288.png",	41}, {"2289.png",	115}, {"229.png",	41}, {"2290.png",	115}, {"2291.png",	157}, {"2292.png",	274}, {"2293.png",	80}, {"2294.png",	215}, {"2295.png",	228}, {"2296.png",	41}, {"2297.png",	36}, {"2298.png",	68}, {"2299.png",	75}, {"23.png",	178}, {"230.png",	37}, {"2300.png",	150}, {"2301.png",	35}, {"2302.png",	35}, {"2303.png",	179}, {"2304.png",	157}, {"2305.png",	253}, {"2306.png",	301}, {"2307.png",	282}, {"2308.png",	80}, {"2309.png",	253}, {"231.png",	121}, {"2310.png",	178}, {"2311.png",	267}, {"2312.png",	140}, {"2313.png",	38}, {"2314.png",	178}, {"2315.png",	194}, {"2316.png",	253}, {"2317.png",	150}, {"2318.png",	40}, {"2319.png",	274}, {"232.png",	274}, {"2320.png",	210}, {"2321.png",	150}, {"2322.png",	178}, {"2323.png",	257}, {"2324.png",	35}, {"2325.png",	306}, {"2326.png",	150}, {"2327.png",	41}, {"2328.png",	179}, {"2329.png",	203}, {"233.png",	157}, {"2330.png",	41}, {"2331.png",	140}, {"2332.png",	157}, {"2333.png",	307}, {"2334.png",	157}, {"2335.png",	150}, {"2336.png",	115}, {"2337.png",	115}, {"2338.png",	68}, {"2339.png",	140}, {"234.png",	245}, {"2340.png",	327}, {"2341.png",	326}, {"2342.png",	140}, {"2343.png",	115}, {"2344.png",	253}, {"2345.png",	319}, {"2346.png",	140}, {"2347.png",	307}, {"2348.png",	130}, {"2349.png",	157}, {"235.png",	121}, {"2350.png",	190}, {"2351.png",	178}, {"2352.png",	267}, {"2353.png",	115}, {"2354.png",	179}, {"2355.png",	141}, {"2356.png",	41}, {"2357.png",	157}, {"2358.png",	115}, {"2359.png",	304}, {"236.png",	182}, {"2360.png",	24}, {"2361.png",	115}, {"2362.png",	115}, {"2363.png",	2}, {"2364.png",	228}, {"2365.png",	267}, {"2366.png",	41}, {"2367.png",	150}, {"2368.png",	121}, {"2369.png",	40}, {"237.png",	247}, {"2370.png",	300}, {"2371.png",	115}, {"2372.png",	66}, {"2373.png",	68}, {"2374.png",	70}, {"2375.png",	41}, {"2376.png",	122}, {"2377.png",	157}, {"2378.png",	130}, {"2379.png",	157}, {"238.png",	41}, {"2380.png",	245}, {"2381.png",	130}, {"2382.png",	300}, {"2383.png",	8}, {"2384.png",	41}, {"2385.png",	152}, {"2386.png",	179}, {"2387.png",	87}, {"2388.png",	123}, {"2389.png",	274}, {"239.png",	35}, {"2390.png",	80}, {"2391.png",	87}, {"2392.png",	304}, {"2393.png",	72}, {"2394.png",	267}, {"2395.png",	169}, {"2396.png",	157}, {"2397.png",	157}, {"2398.png",	140}, {"2399.png",	115}, {"24.png",	157}, {"240.png",	179}, {"2400.png",	113}, {"2401.png",	87}, {"2402.png",	307}, {"2403.png",	130}, {"2404.png",	130}, {"2405.png",	178}, {"2406.png",	115}, {"2407.png",	253}, {"2408.png",	157}, {"2409.png",	68}, {"241.png",	150}, {"2410.png",	205}, {"2411.png",	292}, {"2412.png",	179}, {"2413.png",	274}, {"2414.png",	121}, {"2415.png",	41}, {"2416.png",	115}, {"2417.png",	41}, {"2418.png",	228}, {"2419.png",	178}, {"242.png",	157}, {"2420.png",	41}, {"2421.png",	35}, {"2422.png",	80}, {"2423.png",	157}, {"2424.png",	87}, {"2425.png",	274}, {"2426.png",	68}, {"2427.png",	35}, {"2428.png",	41}, {"2429.png",	130}, {"243.png",	130}, {"2430.png",	31}, {"2431.png",	158}, {"2432.png",	41}, {"2433.png",	81}, {"2434.png",	157}, {"2435.png",	122}, {"2436.png",	304}, {"2437.png",	228}, {"2438.png",	150}, {"2439.png",	274}, {"244.png",	307}, {"2440.png",	150}, {"2441.png",	130}, {"2442.png",	87}, {"2443.png",	41}, {"2444.png",	304}, {"2445.png",	307}, {"2446.png",	68}, {"2447.png",	41}, {"2448.png",	87}, {"2449.png",	157}, {"245.png",	150}, {"2450.png",	115}, {"2451.png",	130}, {"2452.png",	122}, {"2453.png",	130}, {"2454.png",	157}, {"2455.png",	53}, {"2456.png",	31}, {"2457.png",	245}, {"2458.png",	41}, {"2459.png",	122}, {"246.png",	80}, {"2460.png",	115}, {"2461.png",	307}, {"2462.png",	115}, {"2463.png",	307}, {"2464.png",	116}, {"2465.png",	40}, {"2466.png",	108}, {"2467.png",	41}, {"2468.png",	178}, {"2469.png",	286}, {"247.png",	80}, {"2470.png",	130}, {"2471.png",	87}, {"2472.png",	231}, {"2473.png",	40}, {"2474.png",	267}, {"2475.png",	103}, {"2476.png",	121}, {"2477.png",	35}, {"2478.png",	157}, {"2479.png",	115}, {"248.png",	179}, {"2480.png",	253}, {"2481.png",	319}, {"2482.png",	306}, {"2483.png",	80}, {"2484.png",	41}, {"2485.png",	178}, {"2486.png",	113}, {"2487.png",	304}, {"2488.png",	115}, {"2489.png",	212}, {"249.png",	130}, {"2490.png",	157}, {"2491.png",	66}, {"2492.png",	41}, {"2493.png",	41}, {"2494.png",	228}, {"2495.png",	280}, {"2496.png",	87}, {"2497.png",	178}, {"2498.png",	150}, {"2499.png",	28}, {"25.png",	228}, {"250.png",	178}, {"2500.png",	179}, {"2501.png",	157}, {"2502.png",	228}, {"2503.png",	41}, {"2504.png",	109}, {"2505.png",	68}, {"2506.png",	140}, {"2507.png",	31}, {"2508.png",	87}, {"2509.png",	101}, {"251.png",	80}, {"2510.png",	31}, {"2511.png",	279}, {"2512.png",	80}, {"2513.png",	34}, {"2514.png",	235}, {"2515.png",	115}, {"2516.png",	113}, {"2517.png",	228}, {"2518.png",	179}, {"2519.png",	41}, {"252.png",	178}, {"2520.png",	68}, {"2521.png",	115}, {"2522.png",	178}, {"2523.png",	87}, {"2524.png",	35}, {"2525.png",	31}, {"2526.png",	35}, {"2527.png",	80}, {"2528.png",	68}, {"2529.png",	140}, {"253.png",	124}, {"2530.png",	35}, {"2531.png",	80}, {"2532.png",	307}, {"2533.png",	179}, {"2534.png",	274}, {"2535.png",	245}, {"2536.png",	183}, {"2537.png",	68}, {"2538.png",	41}, {"2539.png",	106}, {"254.png",	178}, {"2540.png",	41}, {"2541.png",	150}, {"2542.png",	213}, {"2543.png",	35}, {"2544.png",	115}, {"2545.png",	41}, {"2546.png",	115}, {"2547.png",	326}, {"2548.png",	178}, {"2549.png",	150}, {"255.png",	304}, {"2550.png",	157}, {"2551.png",	274}, {"2552.png",	274}, {"2553.png",	41}, {"2554.png",	178}, {"2555.png",	98}, {"2556.png",	326}, {"2557.png",	178}, {"2558.png",	80}, {"2559.png",	178}, {"256.png",	35}, {"2560.png",	40}, {"2561.png",	31}, {"2562.png",	87}, {"2563.png",	269}, {"2564.png",	163}, {"2565.png",	178}, {"2566.png",	41}, {"2567.png",	307}, {"2568.png",	140}, {"2569.png",	305}, {"257.png",	322}, {"2570.png",	268}, {"2571.png",	87}, {"2572.png",	121}, {"2573.png",	105}, {"2574.png",	35}, {"2575.png",	228}, {"2576.png",	41}, {"2577.png",	151}, {"2578.png",	228}, {"2579.png",	31}, {"258.png",	82}, {"2580.png",	87}, {"2581.png",	130}, {"2582.png",	121}, {"2583.png",	304}, {"2584.png",	87}, {"2585.png",	178}, {"2586.png",	253}, {"2587.png",	115}, {"2588.png",	282}, {"2589.png",	130}, {"259.png",	40}, {"2590.png",	130}, {"2591.png",	253}, {"2592.png",	150}, {"2593.png",	299}, {"2594.png",	253}, {"2595.png",	307}, {"2596.png",	72}, {"2597.png",	307}, {"2598.png",	297}, {"2599.png",	122}, {"26.png",	245}, {"260.png",	178}, {"2600.png",	306}, {"2601.png",	41}, {"2602.png",	40}, {"2603.png",	150}, {"2604.png",	304}, {"2605.png",	150}, {"2606.png",	80}, {"2607.png",	35}, {"2608.png",	245}, {"2609.png",	274}, {"261.png",	130}, {"2610.png",	157}, {"2611.png",	24}, {"2612.png",	87}, {"2613.png",	31}, {"2614.png",	87}, {"2615.png",	157}, {"2616.png",	68}, {"2617.png",	31}, {"2618.png",	157}, {"2619.png",	122}, {"262.png",	31}, {"2620.png",	115}, {"2621.png",	99}, {"2622.png",	178}, {"2623.png",	307}, {"2624.png",	40}, {"2625.png",	115}, {"2626.png",	115}, {"2627.png",	140}, {"2628.png",	87}, {"2629.png",	40}, {"263.png",	80}, {"2630.png",	178}, {"2631.png",	80}, {"2632.png",	40}, {"2633.png",	35}, {"2634.png",	157}, {"2635.png",	115}, {"2636.png",	268}, {"2637.png",	274}, {"2638.png",	68}, {"2639.png",	87}, {"264.png",	87}, {"2640.png",	80}, {"2641.png",	87}, {"2642.png",	257}, {"2643.png",	253}, {"2644.png",	87}, {"2645.png",	87}, {"2646.png",	113}, {"2647.png",	121}, {"2648.png",	300}, {"2649.png",	87}, {"265.png",	87}, {"2650.png",	121}, {"2651.png",	321}, {"2652.png",	150}, {"2653.png",	228}, {"2654.png",	178}, {"2655.png",	115}, {"2656.png",	87}, {"2657.png",	6}, {"2658.png",	41}, {"2659.png",	274}, {"266.png",	130}, {"2660.png",	178}, {"2661.png",	323}, {"2662.png",	239}, {"2663.png",	307}, {"2664.png",	228}, {"2665.png",	274}, {"2666.png",	147}, {"2667.png",	255}, {"2668.png",	40}, {"2669.png",	24}, {"267.png",	178}, {"2670.png",	197}, {"2671.png",	40}, {"2672.png",	157}, {"2673.png",	157}, {"2674.png",	308}, {"2675.png",	14}, {"2676.png",	157}, {"2677.png",	228}, {"2678.png",	179}, {"2679.png",	232}, {"268.png",	178}, {"2680.png",	122}, {"2681.png",	87}, {"2682.png",	121}, {"2683.png",	228}, {"2684.png",	275}, {"2685.png",	274}, {"2686.png",	103}, {"2687.png",	87}, {"2688.png",	115}, {"2689.png",	179}, {"269.png",	35}, {"2690.png",	115}, {"2691.png",	34}, {"2692.png",	31}, {"2693.png",	24}, {"2694.png",	149}, {"2695.png",	35}, {"2696.png",	253}, {"2697.png",	228}, {"2698.png",	157}, {"2699.png",	157}, {"27.png",	140}, {"270.png",	277}, {"2700.png",	178}, {"2701.png",	274}, {"2702.png",	157}, {"2703.png",	179}, {"2704.png",	307}, {"2705.png",	150}, {"2706.png",	118}, {"2707.png",	140}, {"2708.png",	267}, {"2709.png",	274}, {"271.png",	68}, {"2710.png",	121}, {"2711.png",	41}, {"2712.png",	251}, {"2713.png",	141}, {"2714.png",	217}, {"2715.png",	255}, {"2716.png",	123}, {"2717.png",	115}, {"2718.png",	24}, {"2719.png",	87}, {"272.png",	179}, {"2720.png",	262}, {"2721.png",	245}, {"2722.png",	130}, {"2723.png",	157}, {"2724.png",	20}, {"2725.png",	193}, {"2726.png",	157}, {"2727.png",	326}, {"2728.png",	312}, {"2729.png",	315}, {"273.png",	150}, {"2730.png",	326}, {"2731.png",	215}, {"2732.png",	130}, {"2733.png",	274}, {"2734.png",	267}, {"2735.png",	41}, {"2736.png",	228}, {"2737.png",	193}, {"2738.png",	66}, {"2739.png",	73}, {"274.png",	41}, {"2740.png",	34}, {"2741.png",	34}, {"2742.png",	284}, {"2743.png",	40}, {"2744.png",	87}, {"2745.png",	122}, {"2746.png",	274}, {"2747.png",	228}, {"2748.png",	41}, {"2749.png",	320}, {"275.png",	313}, {"2750.png",	250}, {"2751.png",	150}, {"2752.png",	179}, {"2753.png",	274}, {"2754.png",	113}, {"2755.png",	87}, {"2756.png",	80}, {"2757.png",	245}, {"2758.png",	150}, {"2759.png",	277}, {"276.png",	179}, {"2760.png",	87}, {"2761.png",	41}, {"2762.png",	41}, {"2763.png",	35}, {"2764.png",	262}, {"2765.png",	80}, {"2766.png",	179}, {"2767.png",	150}, {"2768.png",	87}, {"2769.png",	80}, {"277.png",	87}, {"2770.png",	140}, {"2771.png",	123}, {"2772.png",	178}, {"2773.png",	113}, {"2774.png",	267}, {"2775.png",	140}, {"2776.png",	87}, {"2777.png",	115}, {"2778.png",	130}, {"2779.png",	115}, {"278.png",	95}, {"2780.png",	41}, {"2781.png",	274}, {"2782.png",	121}, {"2783.png",	40}, {"2784.png",	150}, {"2785.png",	245}, {"2786.png",	245}, {"2787.png",	170}, {"2788.png",	157}, {"2789.png",	41}, {"279.png",	121}, {"2790.png",	31}, {"2791.png",	80}, {"2792.png",	122}, {"2793.png",	87}, {"2794.png",	34}, {"2795.png",	140}, {"2796.png",	274}, {"2797.png",	130}, {"2798.png",	132}, {"2799.png",	150}, {"28.png",	178}, {"280.png",	63}, {"2800.png",	54}, {"2801.png",	24}, {"2802.png",	87}, {"2803.png",	171}, {"2804.png",	31}, {"2805.png",	115}, {"2806.png",	115}, {"2807.png",	95}, {"2808.png",	41}, {"2809.png",	87}, {"281.png",	176}, {"2810.png",	253}, {"2811.png",	35}, {"2812.png",	68}, {"2813.png",	80}, {"2814.png",	307}, {"2815.png",	267}, {"2816.png",	66}, {"2817.png",	319}, {"2818.png",	41}, {"2819.png",	41}, {"282.png",	24}, {"2820.png",	68}, {"2821.png",	178}, {"2822.png",	157}, {"2823.png",	68}, {"2824.png",	219}, {"2825.png",	319}, {"2826.png",	264}, {"2827.png",	157}, {"2828.png",	150}, {"2829.png",	326}, {"283.png",	68}, {"2830.png",	87}, {"2831.png",	115}, {"2832.png",	115}, {"2833.png",	178}, {"2834.png",	80}, {"2835.png",	103}, {"2836.png",	300}, {"2837.png",	280}, {"2838.png",	115}, {"2839.png",	145}, {"284.png",	73}, {"2840.png",	80}, {"2841.png",	87}, {"2842.png",	29}, {"2843.png",	80}, {"2844.png",	228}, {"2845.png",	150}, {"2846.png",	113}, {"2847.png",	267}, {"2848.png",	123}, {"2849.png",	307}, {"285.png",	274}, {"2850.png",	228}, {"2851.png",	115}, {"2852.png",	179}, {"2853.png",	253}, {"2854.png",	267}, {"2855.png",	35}, {"2856.png",	199}, {"2857.png",	40}, {"2858.png",	315}, {"2859.png",	103}, {"286.png",	228}, {"2860.png",	41}, {"2861.png",	115}, {"2862.png",	40}, {"2863.png",	218}, {"2864.png",	115}, {"2865.png",	228}, {"2866.png",	178}, {"2867.png",	209}, {"2868.png",	253}, {"2869.png",	122}, {"287.png",	150}, {"2870.png",	307}, {"2871.png",	35}, {"2872.png",	49}, {"2873.png",	40}, {"2874.png",	257}, {"2875.png",	41}, {"2876.png",	23}, {"2877.png",	38}, {"2878.png",	253}, {"2879.png",	147}, {"288.png",	115}, {"2880.png",	234}, {"2881.png",	245}, {"2882.png",	179}, {"2883.png",	122}, {"2884.png",	87}, {"2885.png",	267}, {"2886.png",	87}, {"2887.png",	231}, {"2888.png",	304}, {"2889.png",	80}, {"289.png",	35}, {"2890.png",	87}, {"2891.png",	122}, {"2892.png",	115}, {"2893.png",	70}, {"2894.png",	178}, {"2895.png",	41}, {"2896.png",	103}, {"2897.png",	87}, {"2898.png",	35}, {"2899.png",	80}, {"29.png",	300}, {"290.png",	228}, {"2900.png",	324}, {"2901.png",	157}, {"2902.png",	109}, {"2903.png",	140}, {"2904.png",	157}, {"2905.png",	41}, {"2906.png",	267}, {"2907.png",	133}, {"2908.png",	115}, {"2909.png",	178}, {"291.png",	101}, {"2910.png",	304}, {"2911.png",	41}, {"2912.png",	296}, {"2913.png",	41}, {"2914.png",	40}, {"2915.png",	168}, {"2916.png",	150}, {"2917.png",	41}, {"2918.png",	181}, {"2919.png",	72}, {"292.png",	115}, {"2920.png",	78}, {"2921.png",	140}, {"2922.png",	41}, {"2923.png",	80}, {"2924.png",	68}, {"2925.png",	115}, {"2926.png",	115}, {"2927.png",	121}, {"2928.png",	157}, {"2929.png",	87}, {"293.png",	253}, {"2930.png",	130}, {"2931.png",	178}, {"2932.png",	80}, {"2933.png",	80}, {"2934.png",	178}, {"2935.png",	35}, {"2936.png",	274}, {"2937.png",	87}, {"2938.png",	41}, {"2939.png",	157}, {"294.png",	60}, {"2940.png",	213}, {"2941.png",	228}, {"2942.png",	157}, {"2943.png",	274}, {"2944.png",	121}, {"2945.png",	300}, {"2946.png",	103}, {"2947.png",	150}, {"2948.png",	35}, {"2949.png",	157}, {"295.png",	205}, {"2950.png",	115}, {"2951.png",	306}, {"2952.png",	115}, {"2953.png",	184}, {"2954.png",	174}, {"2955.png",	122}, {"2956.png",	292}, {"2957.png",	140}, {"2958.png",	140}, {"2959.png",	41}, {"296.png",	228}, {"2960.png",	267}, {"2961.png",	194}, {"2962.png",	10}, {"2963.png",	157}, {"2964.png",	87}, {"2965.png",	307}, {"2966.png",	157}, {"2967.png",	150}, {"2968.png",	150}, {"2969.png",	228}, {"297.png",	150}, {"2970.png",	40}, {"2971.png",	68}, {"2972.png",	115}, {"2973.png",	245}, {"2974.png",	157}, {"2975.png",	274}, {"2976.png",	115}, {"2977.png",	87}, {"2978.png",	115}, {"2979.png",	163}, {"298.png",	66}, {"2980.png",	121}, {"2981.png",	41}, {"2982.png",	267}, {"2983.png",	35}, {"2984.png",	115}, {"2985.png",	157}, {"2986.png",	115}, {"2987.png",	41}, {"2988.png",	115}, {"2989.png",	125}, {"299.png",	228}, {"2990.png",	115}, {"2991.png",	250}, {"2992.png",	157}, {"2993.png",	31}, {"2994.png",	87}, {"2995.png",	122}, {"2996.png",	80}, {"2997.png",	233}, {"2998.png",	121}, {"2999.png",	115}, {"3.png",	38}, {"30.png",	72}, {"300.png",	115}, {"3000.png",	230}, {"3001.png",	319}, {"3002.png",	122}, {"3003.png",	87}, {"3004.png",	157}, {"3005.png",	179}, {"3006.png",	24}, {"3007.png",	41}, {"3008.png",	228}, {"3009.png",	150}, {"301.png",	115}, {"3010.png",	41}, {"3011.png",	35}, {"3012.png",	274}, {"3013.png",	70}, {"3014.png",	60}, {"3015.png",	157}, {"3016.png",	115}, {"3017.png",	150}, {"3018.png",	150}, {"3019.png",	122}, {"302.png",	122}, {"3020.png",	304}, {"3021.png",	274}, {"3022.png",	226}, {"3023.png",	304}, {"3024.png",	122}, {"3025.png",	253}, {"3026.png",	150}, {"3027.png",	66}, {"3028.png",	115}, {"3029.png",	245}, {"303.png",	228}, {"3030.png",	66}, {"3031.png",	31}, {"3032.png",	157}, {"3033.png",	41}, {"3034.png",	304}, {"3035.png",	87}, {"3036.png",	116}, {"3037.png",	157}, {"3038.png",	228}, {"3039.png",	115}, {"304.png",	245}, {"3040.png",	87}, {"3041.png",	24}, {"3042.png",	307}, {"3043.png",	267}, {"3044.png",	121}, {"3045.png",	179}, {"3046.png",	41}, {"3047.png",	130}, {"3048.png",	35}, {"3049.png",	254}, {"305.png",	140}, {"3050.png",	73}, {"3051.png",	121}, {"3052.png",	246}, {"3053.png",	41}, {"3054.png",	87}, {"3055.png",	41}, {"3056.png",	157}, {"3057.png",	115}, {"3058.png",	267}, {"3059.png",	80}, {"306.png",	73}, {"3060.png",	69}, {"3061.png",	87}, {"3062.png",	122}, {"3063.png",	40}, {"3064.png",	150}, {"3065.png",	157}, {"3066.png",	68}, {"3067.png",	157}, {"3068.png",	115}, {"3069.png",	326}, {"307.png",	228}, {"3070.png",	121}, {"3071.png",	157}, {"3072.png",	122}, {"3073.png",	68}, {"3074.png",	150}, {"3075.png",	306}, {"3076.png",	80}, {"3077.png",	41}, {"3078.png",	122}, {"3079.png",	245}, {"308.png",	115}, {"3080.png",	313}, {"3081.png",	245}, {"3082.png",	166}, {"3083.png",	157}, {"3084.png",	274}, {"3085.png",	115}, {"3086.png",	150}, {"3087.png",	266}, {"3088.png",	87}, {"3089.png",	80}, {"309.png",	103}, {"3090.png",	138}, {"3091.png",	274}, {"3092.png",	46}, {"3093.png",	35}, {"3094.png",	267}, {"3095.png",	261}, {"3096.png",	179}, {"3097.png",	304}, {"3098.png",	115}, {"3099.png",	41}, {"31.png",	87}, {"310.png",	228}, {"3100.png",	245}, {"3101.png",	274}, {"3102.png",	80}, {"3103.png",	157}, {"3104.png",	297}, {"3105.png",	41}, {"3106.png",	35}, {"3107.png",	152}, {"3108.png",	150}, {"3109.png",	41}, {"311.png",	121}, {"3110.png",	157}, {"3111.png",	80}, {"3112.png",	41}, {"3113.png",	80}, {"3114.png",	41}, {"3115.png",	140}, {"3116.png",	141}, {"3117.png",	66}, {"3118.png",	263}, {"3119.png",	130}, {"312.png",	274}, {"3120.png",	183}, {"3121.png",	0}, {"3122.png",	267}, {"3123.png",	316}, {"3124.png",	140}, {"3125.png",	157}, {"3126.png",	41}, {"3127.png",	103}, {"3128.png",	274}, {"3129.png",	152}, {"313.png",	157}, {"3130.png",	35}, {"3131.png",	274}, {"3132.png",	245}, {"3133.png",	140}, {"3134.png",	315}, {"3135.png",	253}, {"3136.png",	80}, {"3137.png",	178}, {"3138.png",	228}, {"3139.png",	41}, {"314.png",	246}, {"3140.png",	115}, {"3141.png",	80}, {"3142.png",	150}, {"3143.png",	140}, {"3144.png",	324}, {"3145.png",	41}, {"3146.png",	157}, {"3147.png",	150}, {"3148.png",	228}, {"3149.png",	274}, {"315.png",	87}, {"3150.png",	130}, {"3151.png",	307}, {"3152.png",	87}, {"3153.png",	35}, {"3154.png",	253}, {"3155.png",	87}, {"3156.png",	121}, {"3157.png",	87}, {"3158.png",	178}, {"3159.png",	203}, {"316.png",	157}, {"3160.png",	130}, {"3161.png",	245}, {"3162.png",	157}, {"3163.png",	80}, {"3164.png",	90}, {"3165.png",	157}, {"3166.png",	35}, {"3167.png",	300}, {"3168.png",	157}, {"3169.png",	13}, {"317.png",	157}, {"3170.png",	267}, {"3171.png",	41}, {"3172.png",	68}, {"3173.png",	24}, {"3174.png",	31}, {"3175.png",	35}, {"3176.png",	157}, {"3177.png",	41}, {"3178.png",	245}, {"3179.png",	115}, {"318.png",	273}, {"3180.png",	152}, {"3181.png",	35}, {"3182.png",	31}, {"3183.png",	306}, {"3184.png",	137}, {"3185.png",	115}, {"3186.png",	115}, {"3187.png",	121}, {"3188.png",	150}, {"3189.png",	178}, {"319.png",	68}, {"3190.png",	169}, {"3191.png",	307}, {"3192.png",	178}, {"3193.png",	91}, {"3194.png",	35}, {"3195.png",	127}, {"3196.png",	257}, {"3197.png",	41}, {"3198.png",	328}, {"3199.png",	40}, {"32.png",	329}, {"320.png",	40}, {"3200.png",	307}, {"3201.png",	115}, {"3202.png",	130}, {"3203.png",	207}, {"3204.png",	115}, {"3205.png",	229}, {"3206.png",	35}, {"3207.png",	87}, {"3208.png",	35}, {"3209.png",	178}, {"321.png",	94}, {"3210.png",	68}, {"3211.png",	150}, {"3212.png",	31}, {"3213.png",	80}, {"3214.png",	157}, {"3215.png",	281}, {"3216.png",	41}, {"3217.png",	267}, {"3218.png",	41}, {"3219.png",	106}, {"322.png",	130}, {"3220.png",	87}, {"3221.png",	119}, {"3222.png",	115}, {"3223.png",	157}, {"3224.png",	286}, {"3225.png",	115}, {"3226.png",	179}, {"3227.png",	115}, {"3228.png",	130}, {"3229.png",	157}, {"323.png",	87}, {"3230.png",	87}, {"3231.png",	267}, {"3232.png",	150}, {"3233.png",	66}, {"3234.png",	157}, {"3235.png",	267}, {"3236.png",	68}, {"3237.png",	140}, {"3238.png",	304}, {"3239.png",	140}, {"324.png",	150}, {"3240.png",	87}, {"3241.png",	87}, {"3242.png",	267}, {"3243.png",	157}, {"3244.png",	41}, {"3245.png",	274}, {"3246.png",	140}, {"3247.png",	157}, {"3248.png",	34}, {"3249.png",	31}, {"325.png",	87}, {"3250.png",	304}, {"3251.png",	274}, {"3252.png",	59}, {"3253.png",	31}, {"3254.png",	31}, {"3255.png",	178}, {"3256.png",	121}, {"3257.png",	267}, {"3258.png",	80}, {"3259.png",	194}, {"326.png",	319}, {"3260.png",	35}, {"3261.png",	304}, {"3262.png",	274}, {"3263.png",	122}, {"3264.png",	64}, {"3265.png",	40}, {"3266.png",	179}, {"3267.png",	274}, {"3268.png",	150}, {"3269.png",	157}, {"327.png",	10}, {"3270.png",	157}, {"3271.png",	87}, {"3272.png",	307}, {"3273.png",	40}, {"3274.png",	274}, {"3275.png",	14}, {"3276.png",	40}, {"3277.png",	87}, {"3278.png",	122}, {"3279.png",	41}, {"328.png",	245}, {"3280.png",	130}, {"3281.png",	80}, {"3282.png",	244}, {"3283.png",	113}, {"3284.png",	140}, {"3285.png",	40}, {"3286.png",	68}, {"3287.png",	274}, {"3288.png",	121}, {"3289.png",	40}, {"329.png",	147}, {"3290.png",	157}, {"3291.png",	87}, {"3292.png",	267}, {"3293.png",	87}, {"3294.png",	274}, {"3295.png",	157}, {"3296.png",	178}, {"3297.png",	115}, {"3298.png",	66}, {"3299.png",	228}, {"33.png",	153}, {"330.png",	34}, {"3300.png",	154}, {"3301.png",	24}, {"3302.png",	274}, {"3303.png",	59}, {"3304.png",	307}, {"3305.png",	31}, {"3306.png",	152}, {"3307.png",	173}, {"3308.png",	253}, {"3309.png",	41}, {"331.png",	80}, {"3310.png",	157}, {"3311.png",	73}, {"3312.png",	34}, {"3313.png",	307}, {"3314.png",	41}, {"3315.png",	24}, {"3316.png",	205}, {"3317.png",	35}, {"3318.png",	266}, {"3319.png",	253}, {"332.png",	41}, {"3320.png",	157}, {"3321.png",	203}, {"3322.png",	87}, {"3323.png",	253}, {"3324.png",	157}, {"3325.png",	274}, {"3326.png",	35}, {"3327.png",	304}, {"3328.png",	228}, {"3329.png",	274}, {"333.png",	117}, {"3330.png",	173}, {"3331.png",	140}, {"3332.png",	295}, {"3333.png",	274}, {"3334.png",	31}, {"3335.png",	87}, {"3336.png",	253}, {"3337.png",	103}, {"3338.png",	306}, {"3339.png",	66}, {"334.png",	41}, {"3340.png",	87}, {"3341.png",	157}, {"3342.png",	41}, {"3343.png",	130}, {"3344.png",	178}, {"3345.png",	87}, {"3346.png",	87}, {"3347.png",	257}, {"3348.png",	80}, {"3349.png",	178}, {"335.png",	40}, {"3350.png",	280}, {"3351.png",	274}, {"3352.png",	245}, {"3353.png",	150}, {"3354.png",	128}, {"3355.png",	115}, {"3356.png",	115}, {"3357.png",	17}, {"3358.png",	253}, {"3359.png",	31}, {"336.png",	115}, {"3360.png",	157}, {"3361.png",	245}, {"3362.png",	245}, {"3363.png",	68}, {"3364.png",	228}, {"3365.png",	330}, {"3366.png",	115}, {"3367.png",	41}, {"3368.png",	274}, {"3369.png",	87}, {"337.png",	122}, {"3370.png",	157}, {"3371.png",	68}, {"3372.png",	41}, {"3373.png",	150}, {"3374.png",	160}, {"3375.png",	157}, {"3376.png",	115}, {"3377.png",	66}, {"3378.png",	157}, {"3379.png",	304}, {"338.png",	140}, {"3380.png",	6}, {"3381.png",	115}, {"3382.png",	304}, {"3383.png",	179}, {"3384.png",	267}, {"3385.png",	157}, {"3386.png",	87}, {"3387.png",	179}, {"3388.png",	304}, {"3389.png",	87}, {"339.png",	267}, {"3390.png",	280}, {"3391.png",	274}, {"3392.png",	66}, {"3393.png",	157}, {"3394.png",	115}, {"3395.png",	92}, {"3396.png",	68}, {"3397.png",	41}, {"3398.png",	319}, {"3399.png",	40}, {"34.png",	121}, {"340.png",	87}, {"3400.png",	41}, {"3401.png",	40}, {"3402.png",	280}, {"3403.png",	115}, {"3404.png",	157}, {"3405.png",	253}, {"3406.png",	307}, {"3407.png",	41}, {"3408.png",	115}, {"3409.png",	86}, {"341.png",	150}, {"3410.png",	245}, {"3411.png",	115}, {"3412.png",	157}, {"3413.png",	150}, {"3414.png",	31}, {"3415.png",	115}, {"3416.png",	274}, {"3417.png",	115}, {"3418.png",	130}, {"3419.png",	122}, {"342.png",	179}, {"3420.png",	13}, {"3421.png",	253}, {"3422.png",	150}, {"3423.png",	41}, {"3424.png",	304}, {"3425.png",	140}, {"3426.png",	274}, {"3427.png",	150}, {"3428.png",	130}, {"3429.png",	150}, {"343.png",	41}, {"3430.png",	41}, {"3431.png",	40}, {"3432.png",	115}, {"3433.png",	68}, {"3434.png",	306}, {"3435.png",	115}, {"3436.png",	117}, {"3437.png",	215}, {"3438.png",	178}, {"3439.png",	6}, {"344.png",	115}, {"3440.png",	295}, {"3441.png",	253}, {"3442.png",	140}, {"3443.png",	58}, {"3444.png",	115}, {"3445.png",	66}, {"3446.png",	38}, {"3447.png",	130}, {"3448.png",	253}, {"3449.png",	179}, {"345.png",	267}, {"3450.png",	304}, {"3451.png",	215}, {"3452.png",	41}, {"3453.png",	41}, {"3454.png",	115}, {"3455.png",	35}, {"3456.png",	141}, {"3457.png",	115}, {"3458.png",	130}, {"3459.png",	307}, {"346.png",	122}, {"3460.png",	87}, {"3461.png",	41}, {"3462.png",	80}, {"3463.png",	157}, {"3464.png",	130}, {"3465.png",	80}, {"3466.png",	54}, {"3467.png",	178}, {"3468.png",	150}, {"3469.png",	87}, {"347.png",	157}, {"3470.png",	66}, {"3471.png",	224}, {"3472.png",	41}, {"3473.png",	121}, {"3474.png",	87}, {"3475.png",	304}, {"3476.png",	274}, {"3477.png",	72}, {"3478.png",	41}, {"3479.png",	253}, {"348.png",	121}, {"3480.png",	41}, {"3481.png",	130}, {"3482.png",	253}, {"3483.png",	157}, {"3484.png",	253}, {"3485.png",	41}, {"3486.png",	313}, {"3487.png",	87}, {"3488.png",	140}, {"3489.png",	150}, {"349.png",	87}, {"3490.png",	41}, {"3491.png",	106}, {"3492.png",	95}, {"3493.png",	189}, {"3494.png",	70}, {"3495.png",	169}, {"3496.png",	80}, {"3497.png",	41}, {"3498.png",	157}, {"3499.png",	267}, {"35.png",	157}, {"350.png",	302}, {"3500.png",	130}, {"3501.png",	307}, {"3502.png",	41}, {"3503.png",	228}, {"3504.png",	228}, {"3505.png",	35}, {"3506.png",	115}, {"3507.png",	115}, {"3508.png",	179}, {"3509.png",	115}, {"351.png",	181}, {"3510.png",	115}, {"3511.png",	68}, {"3512.png",	90}, {"3513.png",	274}, {"3514.png",	157}, {"3515.png",	41}, {"3516.png",	178}, {"3517.png",	41}, {"3518.png",	115}, {"3519.png",	68}, {"352.png",	35}, {"3520.png",	80}, {"3521.png",	309}, {"3522.png",	41}, {"3523.png",	115}, {"3524.png",	87}, {"3525.png",	103}, {"3526.png",	121}, {"3527.png",	41}, {"3528.png",	68}, {"3529.png",	122}, {"353.png",	68}, {"3530.png",	115}, {"3531.png",	103}, {"3532.png",	68}, {"3533.png",	130}, {"3534.png",	87}, {"3535.png",	87}, {"3536.png",	41}, {"3537.png",	179}, {"3538.png",	121}, {"3539.png",	178}, {"354.png",	87}, {"3540.png",	87}, {"3541.png",	157}, {"3542.png",	307}, {"3543.png",	38}, {"3544.png",	121}, {"3545.png",	280}, {"3546.png",	152}, {"3547.png",	87}, {"3548.png",	42}, {"3549.png",	178}, {"355.png",	150}, {"3550.png",	199}, {"3551.png",	152}, {"3552.png",	262}, {"3553.png",	245}, {"3554.png",	41}, {"3555.png",	35}, {"3556.png",	115}, {"3557.png",	157}, {"3558.png",	41}, {"3559.png",	157}, {"356.png",	101}, {"3560.png",	113}, {"3561.png",	179}, {"3562.png",	18}, {"3563.png",	179}, {"3564.png",	150}, {"3565.png",	316}, {"3566.png",	115}, {"3567.png",	179}, {"3568.png",	140}, {"3569.png",	41}, {"357.png",	87}, {"3570.png",	179}, {"3571.png",	157}, {"3572.png",	267}, {"3573.png",	179}, {"3574.png",	178}, {"3575.png",	307}, {"3576.png",	41}, {"3577.png",	179}, {"3578.png",	115}, {"3579.png",	157}, {"358.png",	130}, {"3580.png",	157}, {"3581.png",	189}, {"3582.png",	38}, {"3583.png",	228}, {"3584.png",	115}, {"3585.png",	122}, {"3586.png",	255}, {"3587.png",	198}, {"3588.png",	41}, {"3589.png",	87}, {"359.png",	87}, {"3590.png",	130}, {"3591.png",	87}, {"3592.png",	140}, {"3593.png",	41}, {"3594.png",	194}, {"3595.png",	130}, {"3596.png",	245}, {"3597.png",	267}, {"3598.png",	41}, {"3599.png",	115}, {"36.png",	40}, {"360.png",	267}, {"3600.png",	267}, {"3601.png",	68}, {"3602.png",	267}, {"3603.png",	31}, {"3604.png",	245}, {"3605.png",	157}, {"3606.png",	274}, {"3607.png",	267}, {"3608.png",	41}, {"3609.png",	157}, {"361.png",	157}, {"3610.png",	157}, {"3611.png",	115}, {"3612.png",	41}, {"3613.png",	87}, {"3614.png",	253}, {"3615.png",	115}, {"3616.png",	66}, {"3617.png",	130}, {"3618.png",	274}, {"3619.png",	87}, {"362.png",	31}, {"3620.png",	140}, {"3621.png",	274}, {"3622.png",	25}, {"3623.png",	41}, {"3624.png",	157}, {"3625.png",	253}, {"3626.png",	122}, {"3627.png",	194}, {"3628.png",	253}, {"3629.png",	228}, {"363.png",	228}, {"3630.png",	179}, {"3631.png",	122}, {"3632.png",	87}, {"3633.png",	270}, {"3634.png",	87}, {"3635.png",	115}, {"3636.png",	326}, {"3637.png",	80}, {"3638.png",	101}, {"3639.png",	80}, {"364.png",	262}, {"3640.png",	267}, {"3641.png",	311}, {"3642.png",	35}, {"3643.png",	41}, {"3644.png",	326}, {"365.png",	317}, {"366.png",	130}, {"367.png",	130}, {"368.png",	32}, {"369.png",	41}, {"37.png",	157}, {"370.png",	87}, {"371.png",	40}, {"372.png",	178}, {"373.png",	87}, {"374.png",	228}, {"375.png",	87}, {"376.png",	205}, {"377.png",	267}, {"378.png",	107}, {"379.png",	68}, {"38.png",	41}, {"380.png",	267}, {"381.png",	115}, {"382.png",	178}, {"383.png",	300}, {"384.png",	329}, {"385.png",	253}, {"386.png",	253}, {"387.png",	179}, {"388.png",	274}, {"389.png",	41}, {"39.png",	80}, {"390.png",	2}, {"391.png",	31}, {"392.png",	115}, {"393.png",	115}, {"394.png",	87}, {"395.png",	150}, {"396.png",	115}, {"397.png",	35}, {"398.png",	87}, {"399.png",	196}, {"4.png",	274}, {"40.png",	41}, {"400.png",	304}, {"401.png",	157}, {"402.png",	80}, {"403.png",	288}, {"404.png",	82}, {"405.png",	87}, {"406.png",	87}, {"407.png",	5}, {"408.png",	307}, {"409.png",	267}, {"41.png",	202}, {"410.png",	87}, {"411.png",	35}, {"412.png",	41}, {"413.png",	274}, {"414.png",	298}, {"415.png",	68}, {"416.png",	31}, {"417.png",	62}, {"418.png",	80}, {"419.png",	40}, {"42.png",	115}, {"420.png",	121}, {"421.png",	157}, {"422.png",	274}, {"423.png",	34}, {"424.png",	31}, {"425.png",	179}, {"426.png",	306}, {"427.png",	155}, {"428.png",	157}, {"429.png",	80}, {"43.png",	228}, {"430.png",	307}, {"431.png",	16}, {"432.png",	115}, {"433.png",	294}, {"434.png",	150}, {"435.png",	87}, {"436.png",	299}, {"437.png",	140}, {"438.png",	306}, {"439.png",	121}, {"44.png",	159}, {"440.png",	179}, {"441.png",	87}, {"442.png",	253}, {"443.png",	122}, {"444.png",	168}, {"445.png",	306}, {"446.png",	41}, {"447.png",	115}, {"448.png",	222}, {"449.png",	204}, {"45.png",	41}, {"450.png",	150}, {"451.png",	157}, {"452.png",	304}, {"453.png",	115}, {"454.png",	122}, {"455.png",	115}, {"456.png",	150}, {"457.png",	68}, {"458.png",	267}, {"459.png",	87}, {"46.png",	41}, {"460.png",	122}, {"461.png",	66}, {"462.png",	103}, {"463.png",	274}, {"464.png",	41}, {"465.png",	274}, {"466.png",	274}, {"467.png",	307}, {"468.png",	140}, {"469.png",	14}, {"47.png",	130}, {"470.png",	41}, {"471.png",	150}, {"472.png",	121}, {"473.png",	168}, {"474.png",	60}, {"475.png",	178}, {"476.png",	122}, {"477.png",	101}, {"478.png",	253}, {"479.png",	115}, {"48.png",	140}, {"480.png",	150}, {"481.png",	87}, {"482.png",	160}, {"483.png",	274}, {"484.png",	108}, {"485.png",	87}, {"486.png",	274}, {"487.png",	304}, {"488.png",	80}, {"489.png",	283}, {"49.png",	140}, {"490.png",	228}, {"491.png",	31}, {"492.png",	319}, {"493.png",	35}, {"494.png",	31}, {"495.png",	35}, {"496.png",	157}, {"497.png",	38}, {"498.png",	87}, {"499.png",	274}, {"5.png",	326}, {"50.png",	41}, {"500.png",	179}, {"501.png",	80}, {"502.png",	40}, {"503.png",	121}, {"504.png",	103}, {"505.png",	40}, {"506.png",	24}, {"507.png",	115}, {"508.png",	178}, {"509.png",	115}, {"51.png",	245}, {"510.png",	267}, {"511.png",	228}, {"512.png",	253}, {"513.png",	274}, {"514.png",	179}, {"515.png",	41}, {"516.png",	80}, {"517.png",	326}, {"518.png",	35}, {"519.png",	35}, {"52.png",	231}, {"520.png",	40}, {"521.png",	140}, {"522.png",	228}, {"523.png",	157}, {"524.png",	37}, {"525.png",	40}, {"526.png",	41}, {"527.png",	115}, {"528.png",	253}, {"529.png",	267}, {"53.png",	68}, {"530.png",	51}, {"531.png",	249}, {"532.png",	115}, {"533.png",	35}, {"534.png",	317}, {"535.png",	41}, {"536.png",	304}, {"537.png",	41}, {"538.png",	41}, {"539.png",	121}, {"54.png",	157}, {"540.png",	267}, {"541.png",	38}, {"542.png",	87}, {"543.png",	205}, {"544.png",	115}, {"545.png",	179}, {"546.png",	113}, {"547.png",	103}, {"548.png",	87}, {"549.png",	121}, {"55.png",	285}, {"550.png",	31}, {"551.png",	172}, {"552.png",	178}, {"553.png",	41}, {"554.png",	69}, {"555.png",	179}, {"556.png",	68}, {"557.png",	253}, {"558.png",	274}, {"559.png",	304}, {"56.png",	140}, {"560.png",	113}, {"561.png",	267}, {"562.png",	130}, {"563.png",	87}, {"564.png",	253}, {"565.png",	157}, {"566.png",	80}, {"567.png",	157}, {"568.png",	274}, {"569.png",	145}, {"57.png",	150}, {"570.png",	289}, {"571.png",	157}, {"572.png",	157}, {"573.png",	191}, {"574.png",	150}, {"575.png",	40}, {"576.png",	253}, {"577.png",	87}, {"578.png",	178}, {"579.png",	35}, {"58.png",	68}, {"580.png",	41}, {"581.png",	274}, {"582.png",	304}, {"583.png",	41}, {"584.png",	319}, {"585.png",	80}, {"586.png",	87}, {"587.png",	66}, {"588.png",	66}, {"589.png",	253}, {"59.png",	41}, {"590.png",	40}, {"591.png",	245}, {"592.png",	178}, {"593.png",	253}, {"594.png",	66}, {"595.png",	80}, {"596.png",	228}, {"597.png",	157}, {"598.png",	307}, {"599.png",	68}, {"6.png",	35}, {"60.png",	115}, {"600.png",	187}, {"601.png",	115}, {"602.png",	122}, {"603.png",	157}, {"604.png",	80}, {"605.png",	150}, {"606.png",	71}, {"607.png",	286}, {"608.png",	326}, {"609.png",	66}, {"61.png",	87}, {"610.png",	304}, {"611.png",	41}, {"612.png",	150}, {"613.png",	253}, {"614.png",	26}, {"615.png",	24}, {"616.png",	108}, {"617.png",	115}, {"618.png",	87}, {"619.png",	41}, {"62.png",	179}, {"620.png",	140}, {"621.png",	68}, {"622.png",	34}, {"623.png",	80}, {"624.png",	35}, {"625.png",	240}, {"626.png",	253}, {"627.png",	123}, {"628.png",	115}, {"629.png",	274}, {"63.png",	41}, {"630.png",	267}, {"631.png",	274}, {"632.png",	122}, {"633.png",	253}, {"634.png",	178}, {"635.png",	54}, {"636.png",	130}, {"637.png",	80}, {"638.png",	286}, {"639.png",	179}, {"64.png",	228}, {"640.png",	40}, {"641.png",	179}, {"642.png",	103}, {"643.png",	80}, {"644.png",	63}, {"645.png",	179}, {"646.png",	115}, {"647.png",	140}, {"648.png",	68}, {"649.png",	140}, {"65.png",	311}, {"650.png",	41}, {"651.png",	179}, {"652.png",	150}, {"653.png",	156}, {"654.png",	274}, {"655.png",	178}, {"656.png",	41}, {"657.png",	150}, {"658.png",	115}, {"659.png",	179}, {"66.png",	78}, {"660.png",	150}, {"661.png",	157}, {"662.png",	280}, {"663.png",	257}, {"664.png",	228}, {"665.png",	113}, {"666.png",	41}, {"667.png",	115}, {"668.png",	87}, {"669.png",	14}, {"67.png",	274}, {"670.png",	41}, {"671.png",	115}, {"672.png",	326}, {"673.png",	80}, {"674.png",	154}, {"675.png",	41}, {"676.png",	41}, {"677.png",	115}, {"678.png",	179}, {"679.png",	130}, {"68.png",	66}, {"680.png",	253}, {"681.png",	178}, {"682.png",	95}, {"683.png",	178}, {"684.png",	6}, {"685.png",	253}, {"686.png",	121}, {"687.png",	115}, {"688.png",	179}, {"689.png",	41}, {"69.png",	274}, {"690.png",	66}, {"691.png",	314}, {"692.png",	31}, {"693.png",	253}, {"694.png",	199}, {"695.png",	313}, {"696.png",	41}, {"697.png",	108}, {"698.png",	35}, {"699.png",	179}, {"7.png",	68}, {"70.png",	18}, {"700.png",	54}, {"701.png",	115}, {"702.png",	115}, {"703.png",	157}, {"704.png",	306}, {"705.png",	317}, {"706.png",	300}, {"707.png",	35}, {"708.png",	121}, {"709.png",	228}, {"71.png",	253}, {"710.png",	103}, {"711.png",	113}, {"712.png",	252}, {"713.png",	130}, {"714.png",	140}, {"715.png",	157}, {"716.png",	115}, {"717.png",	157}, {"718.png",	35}, {"719.png",	150}, {"72.png",	274}, {"720.png",	215}, {"721.png",	41}, {"722.png",	236}, {"723.png",	179}, {"724.png",	150}, {"725.png",	103}, {"726.png",	40}, {"727.png",	168}, {"728.png",	34}, {"729.png",	40}, {"73.png",	150}, {"730.png",	41}, {"731.png",	263}, {"732.png",	253}, {"733.png",	183}, {"734.png",	122}, {"735.png",	122}, {"736.png",	140}, {"737.png",	274}, {"738.png",	178}, {"739.png",	41}, {"74.png",	178}, {"740.png",	61}, {"741.png",	178}, {"742.png",	72}, {"743.png",	245}, {"744.png",	150}, {"745.png",	225}, {"746.png",	274}, {"747.png",	274}, {"748.png",	258}, {"749.png",	152}, {"75.png",	110}, {"750.png",	68}, {"751.png",	253}, {"752.png",	115}, {"753.png",	115}, {"754.png",	253}, {"755.png",	203}, {"756.png",	134}, {"757.png",	178}, {"758.png",	115}, {"759.png",	44}, {"76.png",	150}, {"760.png",	274}, {"761.png",	130}, {"762.png",	280}, {"763.png",	179}, {"764.png",	150}, {"765.png",	157}, {"766.png",	257}, {"767.png",	157}, {"768.png",	307}, {"769.png",	115}, {"77.png",	157}, {"770.png",	178}, {"771.png",	179}, {"772.png",	130}, {"773.png",	311}, {"774.png",	41}, {"775.png",	115}, {"776.png",	286}, {"777.png",	87}, {"778.png",	304}, {"779.png",	306}, {"78.png",	267}, {"780.png",	41}, {"781.png",	41}, {"782.png",	115}, {"783.png",	110}, {"784.png",	115}, {"785.png",	121}, {"786.png",	68}, {"787.png",	115}, {"788.png",	68}, {"789.png",	87}, {"79.png",	80}, {"790.png",	113}, {"791.png",	88}, {"792.png",	87}, {"793.png",	179}, {"794.png",	4}, {"795.png",	40}, {"796.png",	121}, {"797.png",	121}, {"798.png",	274}, {"799.png",	43}, {"8.png",	68}, {"80.png",	179}, {"800.png",	35}, {"801.png",	121}, {"802.png",	41}, {"803.png",	31}, {"804.png",	31}, {"805.png",	253}, {"806.png",	73}, {"807.png",	41}, {"808.png",	157}, {"809.png",	157}, {"81.png",	115}, {"810.png",	76}, {"811.png",	41}, {"812.png",	89}, {"813.png",	253}, {"814.png",	87}, {"815.png",	253}, {"816.png",	179}, {"817.png",	35}, {"818.png",	35}, {"819.png",	115}, {"82.png",	115}, {"820.png",	206}, {"821.png",	66}, {"822.png",	274}, {"823.png",	95}, {"824.png",	304}, {"825.png",	274}, {"826.png",	178}, {"827.png",	41}, {"828.png",	257}, {"829.png",	87}, {"83.png",	40}, {"830.png",	80}, {"831.png",	40}, {"832.png",	115}, {"833.png",	87}, {"834.png",	68}, {"835.png",	97}, {"836.png",	274}, {"837.png",	307}, {"838.png",	115}, {"839.png",	187}, {"84.png",	274}, {"840.png",	72}, {"841.png",	157}, {"842.png",	157}, {"843.png",	286}, {"844.png",	319}, {"845.png",	228}, {"846.png",	274}, {"847.png",	41}, {"848.png",	115}, {"849.png",	140}, {"85.png",	178}, {"850.png",	115}, {"851.png",	41}, {"852.png",	41}, {"853.png",	157}, {"854.png",	122}, {"855.png",	68}, {"856.png",	130}, {"857.png",	130}, {"858.png",	150}, {"859.png",	178}, {"86.png",	41}, {"860.png",	304}, {"861.png",	267}, {"862.png",	178}, {"863.png",	242}, {"864.png",	80}, {"865.png",	130}, {"866.png",	16}, {"867.png",	157}, {"868.png",	157}, {"869.png",	157}, {"87.png",	267}, {"870.png",	282}, {"871.png",	115}, {"872.png",	80}, {"873.png",	115}, {"874.png",	68}, {"875.png",	259}, {"876.png",	183}, {"877.png",	274}, {"878.png",	54}, {"879.png",	121}, {"88.png",	228}, {"880.png",	140}, {"881.png",	178}, {"882.png",	87}, {"883.png",	274}, {"884.png",	179}, {"885.png",	79}, {"886.png",	84}, {"887.png",	167}, {"888.png",	113}, {"889.png",	40}, {"89.png",	87}, {"890.png",	87}, {"891.png",	130}, {"892.png",	12}, {"893.png",	68}, {"894.png",	274}, {"895.png",	274}, {"896.png",	35}, {"897.png",	87}, {"898.png",	41}, {"899.png",	228}, {"9.png",	326}, {"90.png",	260}, {"900.png",	122}, {"901.png",	68}, {"902.png",	35}, {"903.png",	31}, {"904.png",	80}, {"905.png",	304}, {"906.png",	253}, {"907.png",	115}, {"908.png",	40}, {"909.png",	41}, {"91.png",	35}, {"910.png",	157}, {"911.png",	68}, {"912.png",	15}, {"913.png",	148}, {"914.png",	274}, {"915.png",	80}, {"916.png",	66}, {"917.png",	157}, {"918.png",	157}, {"919.png",	115}, {"92.png",	87}, {"920.png",	130}, {"921.png",	178}, {"922.png",	179}, {"923.png",	274}, {"924.png",	115}, {"925.png",	34}, {"926.png",	140}, {"927.png",	115}, {"928.png",	274}, {"929.png",	179}, {"93.png",	274}, {"930.png",	150}, {"931.png",	63}, {"932.png",	267}, {"933.png",	129}, {"934.png",	122}, {"935.png",	266}, {"936.png",	150}, {"937.png",	103}, {"938.png",	304}, {"939.png",	178}, {"94.png",	300}, {"940.png",	126}, {"941.png",	70}, {"942.png",	87}, {"943.png",	90}, {"944.png",	22}, {"945.png",	245}, {"946.png",	115}, {"947.png",	9}, {"948.png",	274}, {"949.png",	157}, {"95.png",	87}, {"950.png",	180}, {"951.png",	87}, {"952.png",	179}, {"953.png",	80}, {"954.png",	179}, {"955.png",	150}, {"956.png",	245}, {"957.png",	41}, {"958.png",	87}, {"959.png",	115}, {"96.png",	253}, {"960.png",	80}, {"961.png",	87}, {"962.png",	41}, {"963.png",	157}, {"964.png",	122}, {"965.png",	140}, {"966.png",	150}, {"967.png",	134}, {"968.png",	60}, {"969.png",	130}, {"97.png",	80}, {"970.png",	150}, {"971.png",	35}, {"972.png",	150}, {"973.png",	178}, {"974.png",	150}, {"975.png",	140}, {"976.png",	35}, {"977.png",	80}, {"978.png",	87}, {"979.png",	178}, {"98.png",	274}, {"980.png",	267}, {"981.png",	121}, {"982.png",	121}, {"983.png",	205}, {"984.png",	152}, {"985.png",	80}, {"986.png",	121}, {"987.png",	87}, {"988.png",	113}, {"989.png",	41}, {"99.png",	274}, {"990.png",	87}, {"991.png",	274}, {"992.png",	179}, {"993.png",	150}, {"994.png",	253}, {"995.png",	253}, {"996.png",	87}, {"997.png",	157}, {"998.png",	157}, {"999.png",	267}};
-
-#endif // LABELS_H
-
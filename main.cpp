@@ -1,16 +1,21 @@
 #include <iostream>
+#include <sstream>
 #include <memory>
 #include <vector>
 #include <algorithm>
-
-#include <opencv2/highgui/highgui.hpp>
-#include <opencv2/imgproc/imgproc.hpp>
+#include <thread>
 
 #include <boost/filesystem.hpp>
-#include <boost/filesystem/fstream.hpp>
 
-#include "labels.h"
-#include "mask.h"
+#include "assess.h"
+#include "dendrogram.h"
+#include "distance.h"
+#include "glyphbits.h"
+#include "glyphcache.h"
+#include "glyphstore.h"
+#include "methods.h"
+#include "metrics.h"
+#include "preprocess.h"
 
 namespace fs = boost::filesystem;
 
@@ -18,247 +23,345 @@ using namespace std;
 using namespace cv;
 
 
-class ImageData {
-public:
-	ImageData(Mat img) : img(img) { }
-
-	Mat    img;
-	Point  massCentre;
-	string fileName;
-};
-
-
-float computeDistance(const ImageData *d1, const ImageData *d2) {
-
-	const int maxSizeDiff = 5;
-	if (abs(d1->img.cols - d2->img.cols) > maxSizeDiff || abs(d1->img.rows - d2->img.rows) > maxSizeDiff)
-		return 128.0;
-
-	Point tl = Point(
-		-min(d1->massCentre.x, d2->massCentre.x),
-		-min(d1->massCentre.y, d2->massCentre.y)
-	);
-	Point br = Point(
-		min(d1->img.cols - d1->massCentre.x, d2->img.cols - d2->massCentre.x),
-		min(d1->img.rows - d1->massCentre.y, d2->img.rows - d2->massCentre.y)
-	);
-
-	int sum = 0;
-	int weights = 0;
-	for (int dy = tl.y; dy <= br.y; ++dy) {
-		for (int dx = tl.x; dx <= br.x; ++dx) {
-			int weight;
-			if (dy >= -15 && dy <= 15 && dx >= -15 && dx <= 15) {
-				weight = weightsMask[15 + dy][15 + dx] + weightsMask2[15 + dy][15 + dx];
-			} else {
-				weight = 1;
-			}
-			uchar a = d1->img.at<uchar>(d1->massCentre.y + dy, d1->massCentre.x + dx);
-			uchar b = d2->img.at<uchar>(d2->massCentre.y + dy, d2->massCentre.x + dx);
-			sum     += weight * abs(a - b);
-			weights += weight;
-		}
-	}
-
-	return (float)sum / weights;
-}
-
-void cropImage(Mat &img, Mat &res, Point &massCentre) {
-
-	massCentre = Point(0, 0);
-	int weightsSum = 0;
-	bool rowEmpty;
-	int fstRow = img.rows, lastRow = -1;
-	int fstCol = img.cols, lastCol = -1;
-
-	for (int y = 0; y < img.rows; ++y) {
-		rowEmpty = true;
-		for (int x = 0; x < img.cols; ++x) {
-			uchar val = img.at<uchar>(y, x);
-
-			if (val != 255) {
-				fstCol   = min( fstCol, x);
-				lastCol  = max(lastCol, x);
-				rowEmpty = false;
-				massCentre += Point(x, y) * (255 - val);
-				weightsSum += (255 - val);
-			}
+int main(int argc, char *argv[])
+{
+	int threads   = max(1u, thread::hardware_concurrency());
+	int ioThreads = 0;
+	fs::path cachePath;
+	fs::path labelsPath;
+	fs::path dendrogramPath;
+	fs::path modelDir;
+	fs::path metricsPath;
+	fs::path shardDir;
+	unsigned sampleEvery = 0;
+	int blocks    = 4;
+	int processes = 1;
+	int shard     = -1;
+	bool merge    = false;
+	float maxThreshold = 30.0;
+	bool maxThresholdSet = false;
+	bool bitPlanes = false;
+	vector<float> thresholds;
+	vector<string> args;
+
+	for (int i = 1; i < argc; ++i) {
+		string arg = argv[i];
+		if (arg == "--threads" && i + 1 < argc)
+			threads = atoi(argv[++i]);
+		else if (arg == "--io-threads" && i + 1 < argc)
+			ioThreads = atoi(argv[++i]);
+		else if (arg == "--cache" && i + 1 < argc)
+			cachePath = argv[++i];
+		else if (arg == "--labels" && i + 1 < argc)
+			labelsPath = argv[++i];
+		else if (arg == "--dendrogram" && i + 1 < argc)
+			dendrogramPath = argv[++i];
+		else if (arg == "--incremental" && i + 1 < argc)
+			modelDir = argv[++i];
+		else if (arg == "--metrics" && i + 1 < argc)
+			metricsPath = argv[++i];
+		else if (arg == "--sample-pairs" && i + 1 < argc)
+			sampleEvery = atoi(argv[++i]);
+		else if (arg == "--shards" && i + 1 < argc)
+			shardDir = argv[++i];
+		else if (arg == "--blocks" && i + 1 < argc)
+			blocks = atoi(argv[++i]);
+		else if (arg == "--processes" && i + 1 < argc)
+			processes = atoi(argv[++i]);
+		else if (arg == "--shard" && i + 1 < argc)
+			shard = atoi(argv[++i]);
+		else if (arg == "--merge")
+			merge = true;
+		else if (arg == "--bit-planes")
+			bitPlanes = true;
+		else if (arg == "--max-threshold" && i + 1 < argc) {
+			maxThreshold = atof(argv[++i]);
+			maxThresholdSet = true;
 		}
-
-		if (!rowEmpty) {
-			fstRow  = min( fstRow, y);
-			lastRow = max(lastRow, y);
+		else if (arg == "--sweep" && i + 1 < argc) {
+			stringstream list(argv[++i]);
+			string value;
+			while (getline(list, value, ','))
+				thresholds.push_back(atof(value.c_str()));
 		}
+		else
+			args.push_back(arg);
 	}
 
-	massCentre = Point((float)massCentre.x / weightsSum - fstCol, (float)massCentre.y / weightsSum - fstRow);
-	res = img(Rect(fstCol, fstRow, lastCol - fstCol + 1, lastRow - fstRow + 1));
-}
+	if (ioThreads == 0)
+		ioThreads = threads;
+
+	// A dendrogram only holds merges below maxThreshold; one loaded with
+	// another maximum is rebuilt, so this is the limit of every cut
+	const bool sweep = !thresholds.empty();
+	if (!sweep)
+		thresholds.push_back(clusterThreshold);
+	bool thresholdsValid = true;
+	for (float threshold : thresholds)
+		thresholdsValid = thresholdsValid && threshold > 0 && threshold <= maxThreshold;
+
+	const bool sharded = !shardDir.empty();
+
+	if (args.size() != (shard >= 0 ? 1u : 2u) || threads < 1 || ioThreads < 1 || !(maxThreshold > 0 && maxThreshold < 128)
+			|| !thresholdsValid || (dendrogramPath.empty() && (sweep || maxThresholdSet))
+			|| (!modelDir.empty() && !dendrogramPath.empty()) || (sampleEvery > 0 && metricsPath.empty())
+			|| (sharded && (blocks < 1 || processes < 1 || (shard >= 0 && merge)
+				|| !modelDir.empty() || !dendrogramPath.empty() || !cachePath.empty()))
+			|| (!sharded && (shard >= 0 || merge))) {
+		cerr
+			<< "Usage:"  << endl
+			<< argv[0] << " [--threads N] [--io-threads N] [--cache FILE] [--labels FILE] [--bit-planes]" << endl
+			<< "    [--metrics FILE [--sample-pairs N]]" << endl
+			<< "    [--incremental DIR | --dendrogram FILE [--max-threshold T] [--sweep T1,T2,...]" << endl
+			<< "     | --shards DIR [--blocks B] [--processes N] [--shard K | --merge]]" << endl
+			<< "    <input dir> <output file>" << endl
+			<< "    <input dir>     - path to a directory containing *.png files" << endl
+			<< "    <output file>   - place where the output file should be created" << endl
+			<< "    --threads N     - number of clustering threads (default: all cores)" << endl
+			<< "    --io-threads N  - number of image decoding threads (default: --threads)" << endl
+			<< "    --cache FILE    - preprocessed glyphs of <input dir>; used when up to date." << endl
+			<< "                      New and changed images are appended to it, and it is" << endl
+			<< "                      rewritten once more than half of it is out of date" << endl
+			<< "    --labels FILE   - ground truth (\"<file name><tab or comma><label>\" lines)" << endl
+			<< "                      to assess the clusters against, e.g. labels.tsv" << endl
+			<< "    --bit-planes    - rule out pairs by popcounts over binarized glyphs before" << endl
+			<< "                      comparing their pixels (same results; faster or not" << endl
+			<< "                      depending on the glyphs)" << endl
+			<< "    --metrics FILE  - write the wall and CPU time of every stage, what they" << endl
+			<< "                      counted and the cluster sizes to FILE as JSON" << endl
+			<< "    --sample-pairs N - also trace every Nth pair compared in each thread: its" << endl
+			<< "                      names, what ruled it in or out and how long that took" << endl
+			<< "    --dendrogram FILE - single-linkage dendrogram of <input dir>; loaded if it" << endl
+			<< "                      exists, built and saved otherwise. The clusters of every" << endl
+			<< "                      --sweep threshold (default: 15) are reported and those of" << endl
+			<< "                      the first one saved to <output file>" << endl
+			<< "    --max-threshold T - largest threshold the dendrogram supports (default: 30)" << endl
+			<< "                      and --sweep may ask for; one built from other images or" << endl
+			<< "                      up to another threshold is rebuilt" << endl
+			<< "    --incremental DIR - keep the glyphs and clusters of <input dir> in DIR and on" << endl
+			<< "                      later runs only compare images added since and append" << endl
+			<< "                      them to DIR (implies --cache DIR/glyphs.cache). Changed" << endl
+			<< "                      or removed images make it cluster everything again" << endl
+			<< "    --shards DIR    - cluster in separate processes: split the images into B" << endl
+			<< "                      blocks (default: 4), run one process per pair of blocks" << endl
+			<< "                      whose result in DIR is missing or out of date, N at a" << endl
+			<< "                      time (default: 1), and merge their results. Gives the" << endl
+			<< "                      same clusters as a single process; rerunning after a" << endl
+			<< "                      failure only redoes the shards that failed" << endl
+			<< "    --shard K       - only run shard K, given just <input dir>" << endl
+			<< "    --merge         - only merge the shard results in DIR" << endl;
+		return 1;
+	}
 
-void preprocessImage(ImageData *data) {
-	// Crop
-	cropImage(data->img, data->img, data->massCentre);
-}
+	fs::path inputDirPath(args[0]);
+	fs::path outputPath(args.size() > 1 ? args[1] : "");
+
+	GlyphStore          store;
+	vector<vector<int>> clusters;
+
+	unique_ptr<RunMetrics> metrics;
+	if (!metricsPath.empty()) {
+		metrics.reset(new RunMetrics());
+		metrics->sampleEvery = sampleEvery;
+		metrics->settings = {
+			{ "method",          !modelDir.empty() ? "incremental" : !dendrogramPath.empty() ? "dendrogram"
+			                   : shard >= 0 ? "shard" : merge ? "merge" : sharded ? "sharded" : "partition" },
+			{ "distance_kernel", distanceKernelName() },
+			{ "threads",         to_string(threads) },
+			{ "io_threads",      to_string(ioThreads) },
+			{ "bit_planes",      bitPlanes ? "yes" : "no" }
+		};
+	}
 
-void openImages(const fs::path &path, vector<ImageData *> &images) {
+	// Once the clusters are known
+	auto writeMetrics = [&] {
+		if (!metrics)
+			return;
+		metrics->addClusters(clusters);
+		if (!metrics->write(metricsPath))
+			cerr << "Could not write metrics \"" << metricsPath.string() << "\"" << endl;
+	};
 
-	cerr << "> Opening and preprocessing images:" << endl;
-	images.clear();
-	int counter = 0;
+	if (!fs::exists(inputDirPath)) {
+		cerr << "Input folder \"" << inputDirPath << "\" does not exist" << endl;
+		return 1;
+	}
 
-	for (fs::directory_iterator it(path), eod; it != eod; ++it) {
+	if (!fs::is_directory(inputDirPath)) {
+		cerr << "Specified input \"" << inputDirPath << "\" is not a directory" << endl;
+		return 1;
+	}
 
-		fs::path file = fs::absolute(*it);
-		if (!file.has_extension() || file.extension().string() != ".png") {
-			cerr << "Skipping file: \"" << file.string() << "\"" << endl;
-			continue;
-		}
+	if (!modelDir.empty()) {
+		boost::system::error_code error;
+		fs::create_directories(modelDir, error);
+		cachePath = modelDir / "glyphs.cache";
+	}
 
-		Mat tmp = imread(file.string(), CV_LOAD_IMAGE_GRAYSCALE);
-		if (tmp.empty()) {
-			cerr << "Could not load file \"" << file.string() << "\"" << endl;
-			continue;
+	GroundTruth truth;
+	if (!labelsPath.empty()) {
+		if (!truth.load(labelsPath)) {
+			cerr << "Could not read ground truth \"" << labelsPath.string() << "\"" << endl;
+			return 1;
 		}
-
-		++counter;
-		if (counter % 250 == 0)
-			cerr << "\r" << counter;
-
-		ImageData *data = new ImageData(tmp);
-		data->fileName = file.filename().string();
-		preprocessImage(data);
-		images.push_back(data);
+		cerr << "Loaded " << truth.size() << " labels in " << truth.classes() << " classes" << endl;
 	}
 
-	cerr << "\rOpened " << images.size() << " images " << endl;
-}
+	if (!outputPath.empty() && fs::exists(outputPath)) {
+		cerr << "Output file already exists and will be overwritten." << endl;
+	}
 
-void saveClusters(const fs::path &path, const vector<vector<ImageData *>> &clusters) {
-	cerr << "> Saving results to file \"" << path << "\"" << endl;
-	fs::ofstream out(path);
-	size_t numberOfItems = 0;
 
-	for (size_t i = 0; i < clusters.size(); ++i) {
-		if (clusters[i].size() < 1)
-			continue;
+	if (sharded) {
+		boost::system::error_code error;
+		fs::create_directories(shardDir, error);
+		const vector<string> names = listImages(inputDirPath);
 
-		out << clusters[i][0]->fileName;
-		++numberOfItems;
+		if (shard >= 0) {
+			if (!shardMethod(inputDirPath, names, shardDir, blocks, shard, bitPlanes, threads, ioThreads, metrics.get()))
+				return 1;
+			writeMetrics();
+			return 0;
+		}
 
-		for (size_t j = 1; j < clusters[i].size(); ++j) {
-			out << " " << clusters[i][j]->fileName;
-			++numberOfItems;
+		if (!merge) {
+			const vector<int> pending = pendingShards(inputDirPath, names, shardDir, blocks);
+			cerr << "> Running " << pending.size() << " of " << blocks * (blocks + 1) / 2 << " shards, "
+			     << processes << " at a time, logging to \"" << shardDir.string() << "\"" << endl;
+
+			vector<string> shardArgs = { "--shards", shardDir.string(), "--blocks", to_string(blocks),
+			                             "--threads", to_string(threads), "--io-threads", to_string(ioThreads) };
+			if (bitPlanes)
+				shardArgs.push_back("--bit-planes");
+
+			fs::path self = fs::read_symlink("/proc/self/exe", error);
+			const vector<int> failed = runShardProcesses(error ? argv[0] : self.string(), shardArgs,
+			                                             inputDirPath.string(), pending, processes, shardDir);
+			if (!failed.empty()) {
+				cerr << failed.size() << " shards failed:";
+				for (int k : failed)
+					cerr << " " << k;
+				cerr << endl << "Run again to redo just those" << endl;
+				return 1;
+			}
 		}
 
-		out << endl;
-	}
-	out.close();
-	cerr << "Done." << endl;
-}
+		if (!mergeShards(inputDirPath, names, shardDir, blocks, store, clusters, metrics.get()))
+			return 1;
 
-void assesClusters(const vector<vector<ImageData *>> &clusters) {
-	cerr << "> Assesing clusters." << endl;
+		cerr << "Number of clusters: " << clusters.size() << endl;
 
-	map<string, pair<int, ImageData *>> resultLabels;
+		if (!labelsPath.empty())
+			assesClusters(store, clusters, truth, metrics.get());
 
-	int i = 0;
-	for (auto &cluster : clusters) {
-		for (ImageData *element : cluster)
-			resultLabels[element->fileName] = make_pair(i, nullptr);
-		++i;
+		saveClusters(outputPath, store, clusters, metrics.get());
+		writeMetrics();
+		return 0;
 	}
 
+	GlyphCache cache;
+	bool cacheValid = false;
+
+	Dendrogram dendrogram;
+	const bool useDendrogram = !dendrogramPath.empty();
+	bool dendrogramLoaded    = false;
+	uint64_t imagesHash      = 0;
+	if (useDendrogram) {
+		StageTimer timer(metrics.get(), "load_dendrogram");
+		imagesHash = hashImages(inputDirPath, listImages(inputDirPath));
+		dendrogramLoaded = dendrogram.load(dendrogramPath);
+
+		// Rebuilt unless made from the very same images up to the same threshold
+		if (dendrogramLoaded && (dendrogram.imagesHash != imagesHash || dendrogram.maxThreshold != maxThreshold)) {
+			cerr << "> Dendrogram \"" << dendrogramPath.string() << "\" was built "
+			     << (dendrogram.imagesHash != imagesHash ? "from other images" : "up to another threshold")
+			     << ", rebuilding it" << endl;
+			dendrogramLoaded = false;
+			dendrogram = Dendrogram();
+		}
+	}
 
-	int e00 = 0, e01 = 0, e10 = 0, e11 = 0;
-
-	for (auto &v1 : resultLabels) {
-		for (auto &v2 : resultLabels) {
-
-			if (v1.first == v2.first)
-				continue;
-
-			if (v1.second.first == v2.second.first) {
-				if (labels[v1.first] == labels[v2.first])
-					++e11;
-				else
-					++e10;
+	if (dendrogramLoaded) {
+		cerr << "> Loaded dendrogram of " << dendrogram.names.size() << " images up to "
+		     << dendrogram.maxThreshold << " from \"" << dendrogramPath.string() << "\"" << endl;
+		for (const string &name : dendrogram.names)
+			store.add(Mat(), Point(), name);
+	} else {
+		cacheValid = !cachePath.empty() && cache.open(cachePath);
+
+		size_t reused = openImages(inputDirPath, store, ioThreads, cacheValid ? &cache : nullptr, metrics.get());
+
+		// New and changed images are appended to an intact cache as long as at
+		// least half of its entries are still in use; it is rewritten otherwise
+		const bool append = cacheValid && cache.complete() && cache.entries() - reused <= reused;
+		if (!cachePath.empty() && (append ? reused != (size_t)store.size()
+		                                  : reused != (size_t)store.size() || reused != cache.size())) {
+			StageTimer timer(metrics.get(), "write_cache");
+			if (append) {
+				cerr << "> Appending " << store.size() - reused << " glyphs to glyph cache \"" << cachePath.string() << "\"" << endl;
+				if (!cache.append(cachePath, store))
+					cerr << "Could not append to glyph cache" << endl;
 			} else {
-				if (labels[v1.first] == labels[v2.first])
-					++e01;
-				else
-					++e00;
+				cerr << "> Writing glyph cache \"" << cachePath.string() << "\"" << endl;
+				if (!GlyphCache::write(cachePath, store))
+					cerr << "Could not write glyph cache" << endl;
 			}
 		}
 	}
 
-	cerr << "Done." << endl;
-	cerr << "e00: " << e00 << endl
-		 << "e01: " << e01 << endl
-		 << "e10: " << e10 << endl
-		 << "e11: " << e11 << endl;
-}
-
-
-void partitionMethod(const vector<ImageData *>& data, vector<vector<ImageData *>>&clusters) {
-	cerr << "> Clustering images" << endl;
-
-	vector<int> labels;
-	int number = cv::partition(data, labels, [](ImageData *d1, ImageData *d2) {
-		return computeDistance(d1, d2) < 15.0;
-	});
-
-	for (int i=  0; i < number; ++i)
-		clusters.push_back(vector<ImageData *>());
-
-	for (size_t i = 0; i < labels.size(); ++i) {
-		clusters[labels[i]].push_back(data[i]);
+	// The incremental method binarizes just the glyphs it compares
+	unique_ptr<GlyphBits> bits;
+	if (bitPlanes && !dendrogramLoaded && modelDir.empty()) {
+		StageTimer timer(metrics.get(), "bit_planes");
+		cerr << "> Binarizing glyphs" << endl;
+		bits.reset(new GlyphBits(store));
 	}
 
-	cerr << "Done" << endl;
-}
+	if (!modelDir.empty()) {
+		incrementalMethod(store, bitPlanes, cacheValid ? &cache : nullptr, modelDir / "clusters.bin", clusters, threads,
+		                  metrics.get());
 
+		cerr << "Number of clusters: " << clusters.size() << endl;
 
+		if (!labelsPath.empty())
+			assesClusters(store, clusters, truth, metrics.get());
 
-int main(int argc, char *argv[])
-{
-	if (argc != 3) {
-		cerr
-			<< "Usage:"  << endl
-			<< argv[0] << " <input dir> <output file>" << endl
-			<< "    <input dir>   - path to a directory containing *.png files" << endl
-			<< "    <output file> - place where the output file should be created" << endl;
-		return 1;
+		saveClusters(outputPath, store, clusters, metrics.get());
+		writeMetrics();
+		return 0;
 	}
 
-	fs::path inputDirPath(argv[1]);
-	fs::path outputPath(argv[2]);
+	if (!useDendrogram) {
+		partitionMethod(store, bits.get(), clusters, threads, metrics.get());
 
-	if (!fs::exists(inputDirPath)) {
-		cerr << "Input folder \"" << inputDirPath << "\" does not exist" << endl;
-		return 1;
-	}
+		cerr << "Number of clusters: " << clusters.size() << endl;
 
-	if (!fs::is_directory(inputDirPath)) {
-		cerr << "Specified input \"" << inputDirPath << "\" is not a directory" << endl;
-		return 1;
-	}
+		if (!labelsPath.empty())
+			assesClusters(store, clusters, truth, metrics.get());
 
-	if (fs::exists(outputPath)) {
-		cerr << "Output file already exists and will be overwritten." << endl;
+		saveClusters(outputPath, store, clusters, metrics.get());
+		writeMetrics();
+		return 0;
 	}
 
-	vector<ImageData *>        data;
-	vector<vector<ImageData*>> clusters;
-
-	openImages(inputDirPath, data);
-
-	partitionMethod(data, clusters);
+	if (!dendrogramLoaded) {
+		dendrogramMethod(store, bits.get(), dendrogram, maxThreshold, threads, metrics.get());
+		dendrogram.imagesHash = imagesHash;
+		StageTimer timer(metrics.get(), "save_dendrogram");
+		cerr << "> Saving dendrogram to \"" << dendrogramPath.string() << "\"" << endl;
+		if (!dendrogram.save(dendrogramPath))
+			cerr << "Could not write dendrogram" << endl;
+	}
 
-	cerr << "Number of clusters: " << clusters.size() << endl;
+	sweepThresholds(dendrogram, thresholds, labelsPath.empty() ? nullptr : &truth, metrics.get());
 
-	assesClusters(clusters);
+	vector<int> labels;
+	int number = dendrogram.cut(thresholds[0], labels);
+	labelsToClusters(labels, number, clusters);
+	cerr << "Number of clusters at " << thresholds[0] << ": " << clusters.size() << endl;
 
-	saveClusters(outputPath, clusters);
+	saveClusters(outputPath, store, clusters, metrics.get());
+	writeMetrics();
 
 	return 0;
 }
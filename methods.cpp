@@ -0,0 +1,404 @@
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include <boost/filesystem/fstream.hpp>
+
+#include "distance.h"
+#include "incremental.h"
+#include "methods.h"
+#include "preprocess.h"
+#include "unionfind.h"
+
+namespace fs = boost::filesystem;
+
+using namespace std;
+
+
+namespace {
+
+// Class of a glyph; those missing from the ground truth share one extra class
+int truthClass(const GroundTruth &truth, const string &fileName, size_t &unlabeled) {
+	int label = truth.label(fileName);
+	if (label < 0) {
+		label = truth.classes();
+		++unlabeled;
+	}
+	return label;
+}
+
+// Stats to fill in by a clustering stage, sampling if metrics asks for it
+PartitionStats startStats(const RunMetrics *metrics) {
+	PartitionStats stats;
+	stats.sampleEvery = metrics ? metrics->sampleEvery : 0;
+	return stats;
+}
+
+void reportPartitionStats(const GlyphStore &store, const PartitionStats &stats, RunMetrics *metrics) {
+	if (metrics)
+		metrics->addPartitionStats(store, stats);
+
+	cerr << "Pairs: " << stats.pairs
+	     << ", candidates: " << stats.candidates
+	     << ", pruned by profiles: " << stats.pruned
+	     << ", by bit planes: " << stats.bitPruned << endl;
+	cerr << "Pairs evaluated: " << stats.distance.evaluated
+	     << ", rejected by size: " << stats.distance.sizeRejected
+	     << ", early exits: " << stats.distance.earlyExits << endl;
+	if (stats.pairs > 0)
+		cerr << "Pruning ratio: " << 100.0 * (stats.pairs - stats.distance.evaluated) / stats.pairs << "%" << endl;
+}
+
+} // namespace
+
+
+void saveClusters(const fs::path &path, const GlyphStore &store, const vector<vector<int>> &clusters, RunMetrics *metrics) {
+	StageTimer timer(metrics, "save");
+	cerr << "> Saving results to file \"" << path << "\"" << endl;
+	fs::ofstream out(path);
+	size_t numberOfItems = 0;
+
+	for (size_t i = 0; i < clusters.size(); ++i) {
+		if (clusters[i].size() < 1)
+			continue;
+
+		out << store.fileName(clusters[i][0]);
+		++numberOfItems;
+
+		for (size_t j = 1; j < clusters[i].size(); ++j) {
+			out << " " << store.fileName(clusters[i][j]);
+			++numberOfItems;
+		}
+
+		out << endl;
+	}
+	out.close();
+	cerr << "Done." << endl;
+}
+
+void assesClusters(const GlyphStore &store, const vector<vector<int>> &clusters, const GroundTruth &truth, RunMetrics *metrics) {
+	StageTimer timer(metrics, "assess");
+	cerr << "> Assesing clusters." << endl;
+
+	vector<int> clusterOf, labelOf;
+	size_t unlabeled = 0;
+
+	for (size_t i = 0; i < clusters.size(); ++i) {
+		for (int element : clusters[i]) {
+			clusterOf.push_back(i);
+			labelOf.push_back(truthClass(truth, store.fileName(element), unlabeled));
+		}
+	}
+
+	if (unlabeled > 0)
+		cerr << unlabeled << " images have no ground truth label" << endl;
+
+	ClusterScores scores = scoreClusters(clusterOf, labelOf);
+
+	cerr << "Done." << endl;
+	cerr << "e00: " << scores.e00 << endl
+		 << "e01: " << scores.e01 << endl
+		 << "e10: " << scores.e10 << endl
+		 << "e11: " << scores.e11 << endl
+		 << "Rand index: "          << scores.randIndex    << endl
+		 << "Adjusted Rand index: " << scores.adjustedRand << endl
+		 << "Purity: "              << scores.purity       << endl
+		 << "NMI: "                 << scores.nmi          << endl;
+}
+
+void sweepThresholds(const Dendrogram &dendrogram, const vector<float> &thresholds, const GroundTruth *truth,
+                     RunMetrics *metrics) {
+	StageTimer timer(metrics, "sweep");
+	cerr << "> Sweeping " << thresholds.size() << " thresholds" << endl;
+
+	vector<int> labelOf;
+	size_t unlabeled = 0;
+	if (truth) {
+		for (const string &name : dendrogram.names)
+			labelOf.push_back(truthClass(*truth, name, unlabeled));
+		if (unlabeled > 0)
+			cerr << unlabeled << " images have no ground truth label" << endl;
+	}
+
+	cerr << "threshold\tclusters";
+	if (truth)
+		cerr << "\te00\te01\te10\te11\trand\tadjusted_rand\tpurity\tnmi";
+	cerr << endl;
+
+	vector<int> clusterOf;
+	for (float threshold : thresholds) {
+		int number = dendrogram.cut(threshold, clusterOf);
+		cerr << threshold << "\t" << number;
+		if (truth) {
+			ClusterScores scores = scoreClusters(clusterOf, labelOf);
+			cerr << "\t" << scores.e00 << "\t" << scores.e01 << "\t" << scores.e10 << "\t" << scores.e11
+			     << "\t" << scores.randIndex << "\t" << scores.adjustedRand
+			     << "\t" << scores.purity << "\t" << scores.nmi;
+		}
+		cerr << endl;
+	}
+}
+
+void labelsToClusters(const vector<int> &labels, int number, vector<vector<int>> &clusters) {
+	for (int i=  0; i < number; ++i)
+		clusters.push_back(vector<int>());
+
+	for (size_t i = 0; i < labels.size(); ++i) {
+		clusters[labels[i]].push_back(i);
+	}
+}
+
+void partitionMethod(const GlyphStore &store, const GlyphBits *bits, vector<vector<int>> &clusters, int threads,
+                     RunMetrics *metrics) {
+	StageTimer timer(metrics, "cluster");
+	cerr << "> Clustering images" << endl;
+	cerr << "Distance kernel: " << distanceKernelName() << ", threads: " << threads << endl;
+
+	PartitionStats stats = startStats(metrics);
+	vector<int> labels;
+	int number = partitionParallel(store, bits, clusterThreshold, threads, labels, stats);
+
+	reportPartitionStats(store, stats, metrics);
+	labelsToClusters(labels, number, clusters);
+
+	cerr << "Done" << endl;
+}
+
+void dendrogramMethod(const GlyphStore &store, const GlyphBits *bits, Dendrogram &dendrogram, float maxThreshold, int threads,
+                      RunMetrics *metrics) {
+	StageTimer timer(metrics, "dendrogram");
+	cerr << "> Building single-linkage dendrogram up to " << maxThreshold << endl;
+	cerr << "Distance kernel: " << distanceKernelName() << ", threads: " << threads << endl;
+
+	PartitionStats stats = startStats(metrics);
+	dendrogram.names.clear();
+	for (int i = 0; i < store.size(); ++i)
+		dendrogram.names.push_back(store.fileName(i));
+	dendrogram.maxThreshold = maxThreshold;
+	minimumSpanningForest(store, bits, maxThreshold, threads, dendrogram.edges, stats);
+
+	reportPartitionStats(store, stats, metrics);
+	cerr << "Done, " << dendrogram.edges.size() << " merges" << endl;
+}
+
+void incrementalMethod(const GlyphStore &store, bool bitPlanes, const GlyphCache *cache,
+                       const fs::path &modelPath, vector<vector<int>> &clusters, int threads, RunMetrics *metrics) {
+	StageTimer timer(metrics, "incremental");
+
+	ClusterModel model;
+	vector<int> labels(store.size(), -1), representatives, added;
+	bool usable = cache && model.load(modelPath);
+
+	// Glyph of every model entry; new glyphs are appended to the model
+	vector<int> toData(usable ? model.names.size() : 0);
+	if (usable) {
+		unordered_map<string, int> indexOf;
+		for (int i = 0; i < store.size(); ++i)
+			indexOf[store.fileName(i)] = i;
+
+		for (size_t k = 0; k < model.names.size() && usable; ++k) {
+			auto it = indexOf.find(model.names[k]);
+			usable = it != indexOf.end()
+			      && cache->contains(model.names[k], store.fileSize(it->second), store.fileTime(it->second));
+			if (usable) {
+				toData[k] = it->second;
+				labels[it->second] = model.labels[k];
+			}
+		}
+
+		for (int representative : model.representatives)
+			representatives.push_back(toData[representative]);
+		for (int i = 0; i < store.size(); ++i) {
+			if (labels[i] < 0)
+				added.push_back(i);
+		}
+	}
+
+	PartitionStats stats = startStats(metrics);
+	int number;
+	if (usable) {
+		cerr << "> Adding " << added.size() << " images to " << model.representatives.size() << " clusters" << endl;
+		number = extendClusters(store, bitPlanes, added, clusterThreshold, threads, labels, representatives, stats);
+	} else {
+		cerr << "> No usable model in \"" << modelPath.string() << "\", clustering all images" << endl;
+		unique_ptr<GlyphBits> bits;
+		if (bitPlanes)
+			bits.reset(new GlyphBits(store));
+		number = partitionParallel(store, bits.get(), clusterThreshold, threads, labels, stats);
+		representatives = chooseRepresentatives(store, labels, number, vector<int>(number, -1));
+		model.names.clear();
+		toData.clear();
+		added.resize(store.size());
+		for (int i = 0; i < store.size(); ++i)
+			added[i] = i;
+	}
+	reportPartitionStats(store, stats, metrics);
+
+	for (int i : added) {
+		model.names.push_back(store.fileName(i));
+		toData.push_back(i);
+	}
+	vector<int> fromData(store.size());
+	model.labels.resize(toData.size());
+	for (size_t k = 0; k < toData.size(); ++k) {
+		fromData[toData[k]] = k;
+		model.labels[k] = labels[toData[k]];
+	}
+	model.representatives.clear();
+	for (int representative : representatives)
+		model.representatives.push_back(fromData[representative]);
+
+	// An intact model only gets the new glyphs and the clusters they changed
+	if (!(usable && model.complete() ? model.append(modelPath) : model.save(modelPath)))
+		cerr << "Could not write cluster model \"" << modelPath.string() << "\"" << endl;
+
+	labelsToClusters(labels, number, clusters);
+	cerr << "Done" << endl;
+}
+
+bool shardMethod(const fs::path &inputDir, const vector<string> &names, const fs::path &shardDir, int blocks,
+                 int shard, bool bitPlanes, int threads, int ioThreads, RunMetrics *metrics) {
+	StageTimer timer(metrics, "shard");
+
+	const ShardPlan plan(names.size(), blocks, clusterThreshold);
+	if (shard < 0 || shard >= plan.shards()) {
+		cerr << "There is no shard " << shard << ", only " << plan.shards() << endl;
+		return false;
+	}
+
+	int a, b;
+	plan.blocksOf(shard, a, b);
+	cerr << "> Shard " << shard << " of " << plan.shards() << ": images "
+	     << plan.blockBegin(a) << "-" << plan.blockBegin(a + 1) - 1 << " against "
+	     << plan.blockBegin(b) << "-" << plan.blockBegin(b + 1) - 1 << endl;
+
+	vector<string> files(names.begin() + plan.blockBegin(a), names.begin() + plan.blockBegin(a + 1));
+	if (b != a)
+		files.insert(files.end(), names.begin() + plan.blockBegin(b), names.begin() + plan.blockBegin(b + 1));
+
+	GlyphStore store;
+	openImages(inputDir, files, store, ioThreads, nullptr, metrics);
+
+	unique_ptr<GlyphBits> bits;
+	if (bitPlanes)
+		bits.reset(new GlyphBits(store));
+
+	// Index of every glyph among all images; those of block a come first
+	vector<int> global(store.size());
+	vector<char> loaded(names.size(), 0);
+	int split = 0;
+	for (int i = 0; i < store.size(); ++i) {
+		global[i] = lower_bound(names.begin(), names.end(), string(store.fileName(i))) - names.begin();
+		loaded[global[i]] = 1;
+		if (global[i] < plan.blockBegin(b))
+			split = i + 1;
+	}
+
+	ShardResult result;
+	for (int block : { a, b }) {
+		for (int g = plan.blockBegin(block); g < plan.blockBegin(block + 1); ++g) {
+			if (!loaded[g])
+				result.failed.push_back(g);
+		}
+		if (a == b)
+			break;
+	}
+
+	PartitionStats stats = startStats(metrics);
+	vector<int> labels;
+	const int number = a == b ? partitionParallel(store, bits.get(), plan.threshold, threads, labels, stats)
+	                          : partitionAcross(store, bits.get(), plan.threshold, split, threads, labels, stats);
+	reportPartitionStats(store, stats, metrics);
+
+	// Every glyph is joined to the first one of its cluster
+	vector<int> first(number, -1);
+	for (int i = 0; i < store.size(); ++i) {
+		if (first[labels[i]] < 0)
+			first[labels[i]] = i;
+		else
+			result.edges.push_back(make_pair(global[first[labels[i]]], global[i]));
+	}
+
+	const fs::path file = shardFile(shardDir, shard);
+	cerr << "> Saving " << result.edges.size() << " edges to \"" << file.string() << "\"" << endl;
+	if (!saveShard(file, plan, shard, hashImages(inputDir, names), result)) {
+		cerr << "Could not write shard" << endl;
+		return false;
+	}
+	cerr << "Done" << endl;
+	return true;
+}
+
+vector<int> pendingShards(const fs::path &inputDir, const vector<string> &names, const fs::path &shardDir,
+                          int blocks) {
+	const ShardPlan plan(names.size(), blocks, clusterThreshold);
+	const uint64_t hash = hashImages(inputDir, names);
+
+	vector<int> pending;
+	ShardResult result;
+	for (int shard = 0; shard < plan.shards(); ++shard) {
+		if (!loadShard(shardFile(shardDir, shard), plan, shard, hash, result))
+			pending.push_back(shard);
+	}
+	return pending;
+}
+
+bool mergeShards(const fs::path &inputDir, const vector<string> &names, const fs::path &shardDir, int blocks,
+                 GlyphStore &store, vector<vector<int>> &clusters, RunMetrics *metrics) {
+	StageTimer timer(metrics, "merge");
+
+	const ShardPlan plan(names.size(), blocks, clusterThreshold);
+	const uint64_t hash = hashImages(inputDir, names);
+	cerr << "> Merging " << plan.shards() << " shards" << endl;
+
+	ConcurrentUnionFind sets(names.size());
+	vector<char> failed(names.size(), 0);
+	vector<int> missing;
+	unsigned long long edges = 0;
+
+	ShardResult result;
+	for (int shard = 0; shard < plan.shards(); ++shard) {
+		if (!loadShard(shardFile(shardDir, shard), plan, shard, hash, result)) {
+			missing.push_back(shard);
+			continue;
+		}
+		for (int image : result.failed)
+			failed[image] = 1;
+		for (const pair<int, int> &edge : result.edges)
+			sets.unite(edge.first, edge.second);
+		edges += result.edges.size();
+	}
+
+	if (!missing.empty()) {
+		cerr << missing.size() << " shards are missing or out of date:";
+		for (int shard : missing)
+			cerr << " " << shard;
+		cerr << endl;
+		return false;
+	}
+
+	// Numbered in order of first appearance among the loaded images, as
+	// partitionParallel does
+	GlyphStore().swap(store);
+	vector<int> labels, labelOfRoot(names.size(), -1);
+	int number = 0;
+	for (size_t g = 0; g < names.size(); ++g) {
+		if (failed[g])
+			continue;
+		store.add(cv::Mat(), cv::Point(), names[g]);
+		int &label = labelOfRoot[sets.find(g)];
+		if (label < 0)
+			label = number++;
+		labels.push_back(label);
+	}
+	labelsToClusters(labels, number, clusters);
+
+	if (metrics) {
+		metrics->count("shards",      plan.shards());
+		metrics->count("shard_edges", edges);
+	}
+	cerr << "Done, " << edges << " edges" << endl;
+	return true;
+}
@@ -0,0 +1,76 @@
+#ifndef METHODS_H
+#define METHODS_H
+
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "assess.h"
+#include "dendrogram.h"
+#include "glyphbits.h"
+#include "glyphcache.h"
+#include "glyphstore.h"
+#include "metrics.h"
+#include "shards.h"
+
+// Distance below which glyphs are clustered together, unless a dendrogram
+// is cut elsewhere.
+const float clusterThreshold = 15.0;
+
+// Each of these records its wall and CPU time, and the clustering methods
+// their counters and samples, in metrics unless that is null.
+
+// Writes one line of space separated file names per cluster.
+void saveClusters(const boost::filesystem::path &path, const GlyphStore &store,
+                  const std::vector<std::vector<int>> &clusters, RunMetrics *metrics = nullptr);
+
+// Scores the clusters against the ground truth and prints the scores.
+void assesClusters(const GlyphStore &store, const std::vector<std::vector<int>> &clusters, const GroundTruth &truth,
+                   RunMetrics *metrics = nullptr);
+
+// Clusters for every threshold cut from the dendrogram, scored against the
+// ground truth if there is one, as one tab separated table.
+void sweepThresholds(const Dendrogram &dendrogram, const std::vector<float> &thresholds, const GroundTruth *truth,
+                     RunMetrics *metrics = nullptr);
+
+// Glyph indices of each of number clusters.
+void labelsToClusters(const std::vector<int> &labels, int number, std::vector<std::vector<int>> &clusters);
+
+// Threshold clustering of all glyphs at clusterThreshold.
+void partitionMethod(const GlyphStore &store, const GlyphBits *bits, std::vector<std::vector<int>> &clusters,
+                     int threads, RunMetrics *metrics = nullptr);
+
+// Builds the dendrogram of all glyphs up to maxThreshold.
+void dendrogramMethod(const GlyphStore &store, const GlyphBits *bits, Dendrogram &dendrogram,
+                      float maxThreshold, int threads, RunMetrics *metrics = nullptr);
+
+// Clusters the store reusing the model saved in modelPath, provided every
+// glyph it knows is still there and unchanged according to the cache; then
+// only the images added since are compared, and they are appended to the
+// model with the clusters they changed. Otherwise everything is clustered
+// anew and the model rewritten. With bitPlanes, only the glyphs that are
+// compared get binarized.
+void incrementalMethod(const GlyphStore &store, bool bitPlanes, const GlyphCache *cache,
+                       const boost::filesystem::path &modelPath, std::vector<std::vector<int>> &clusters,
+                       int threads, RunMetrics *metrics = nullptr);
+
+// Threshold clustering of shard of the plan splitting names (listImages of
+// inputDir) into blocks, loading only the images of its blocks. Saves the
+// result to shardFile(shardDir, shard); false if that failed or there is no
+// such shard.
+bool shardMethod(const boost::filesystem::path &inputDir, const std::vector<std::string> &names,
+                 const boost::filesystem::path &shardDir, int blocks, int shard, bool bitPlanes,
+                 int threads, int ioThreads, RunMetrics *metrics = nullptr);
+
+// Shards without an up to date result in shardDir.
+std::vector<int> pendingShards(const boost::filesystem::path &inputDir, const std::vector<std::string> &names,
+                               const boost::filesystem::path &shardDir, int blocks);
+
+// Joins the results of all shards into the clusters partitionMethod finds on
+// the same images, labelled the same way; store gets the names of the
+// images that could be loaded. False, listing them, if shards are missing.
+bool mergeShards(const boost::filesystem::path &inputDir, const std::vector<std::string> &names,
+                 const boost::filesystem::path &shardDir, int blocks, GlyphStore &store, std::vector<std::vector<int>> &clusters, RunMetrics *metrics = nullptr);
+
+#endif // METHODS_H
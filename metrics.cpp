@@ -0,0 +1,158 @@
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <map>
+
+#include <sys/resource.h>
+
+#include <boost/filesystem/fstream.hpp>
+
+#include "metrics.h"
+
+namespace fs = boost::filesystem;
+
+using namespace std;
+
+
+namespace {
+
+string jsonString(const string &text) {
+	string res = "\"";
+	for (unsigned char c : text) {
+		if (c == '"' || c == '\\') {
+			res += '\\';
+			res += c;
+		} else if (c < 0x20) {
+			char escaped[8];
+			snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+			res += escaped;
+		} else {
+			res += c;
+		}
+	}
+	return res + "\"";
+}
+
+const char *outcomeName(PairOutcome outcome) {
+	switch (outcome) {
+	case PairOutcome::sizes:     return "sizes";
+	case PairOutcome::profiles:  return "profiles";
+	case PairOutcome::bitPlanes: return "bit_planes";
+	case PairOutcome::apart:     return "apart";
+	case PairOutcome::match:     return "match";
+	}
+	return "";
+}
+
+double secondsSince(chrono::steady_clock::time_point start) {
+	return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+
+double processCpuSeconds() {
+	timespec time;
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time);
+	return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+RunMetrics::RunMetrics() : start(chrono::steady_clock::now()), startCpu(processCpuSeconds()) {
+}
+
+void RunMetrics::count(const string &name, unsigned long long value) {
+	for (auto &counter : counters) {
+		if (counter.first == name) {
+			counter.second += value;
+			return;
+		}
+	}
+	counters.push_back(make_pair(name, value));
+}
+
+void RunMetrics::addStage(const string &name, double wallSeconds, double cpuSeconds) {
+	stages.push_back(Stage{ name, wallSeconds, cpuSeconds });
+}
+
+void RunMetrics::addPartitionStats(const GlyphStore &store, const PartitionStats &stats) {
+	count("pairs",                stats.pairs);
+	count("candidates",           stats.candidates);
+	count("pruned_by_profiles",   stats.pruned);
+	count("pruned_by_bit_planes", stats.bitPruned);
+	count("distance_evaluations", stats.distance.evaluated);
+	count("size_rejections",      stats.distance.sizeRejected);
+	count("early_exits",          stats.distance.earlyExits);
+
+	// Threads hand in their samples in any order
+	vector<PairSample> sorted = stats.samples;
+	sort(sorted.begin(), sorted.end(), [](const PairSample &x, const PairSample &y) {
+		return x.a != y.a ? x.a < y.a : x.b < y.b;
+	});
+	for (const PairSample &sample : sorted)
+		samples.push_back(Sample{ store.fileName(sample.a), store.fileName(sample.b), sample.outcome, sample.nanoseconds });
+}
+
+void RunMetrics::addClusters(const vector<vector<int>> &clusters) {
+	map<size_t, size_t> histogram;
+	for (const vector<int> &cluster : clusters)
+		++histogram[cluster.size()];
+
+	count("clusters", clusters.size());
+	clusterSizes.assign(histogram.begin(), histogram.end());
+}
+
+bool RunMetrics::write(const fs::path &file) const {
+	rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+
+	fs::ofstream out(file);
+	out.precision(9);
+
+	out << "{\n";
+	for (const auto &setting : settings)
+		out << "  " << jsonString(setting.first) << ": " << jsonString(setting.second) << ",\n";
+	out << "  \"wall_seconds\": " << secondsSince(start) << ",\n"
+	    << "  \"cpu_seconds\": " << processCpuSeconds() - startCpu << ",\n"
+	    << "  \"peak_rss_kb\": " << usage.ru_maxrss << ",\n";
+
+	out << "  \"stages\": [";
+	for (size_t k = 0; k < stages.size(); ++k) {
+		out << (k ? ",\n" : "\n")
+		    << "    {\"name\": " << jsonString(stages[k].name)
+		    << ", \"wall_seconds\": " << stages[k].wallSeconds
+		    << ", \"cpu_seconds\": " << stages[k].cpuSeconds << "}";
+	}
+	out << "\n  ],\n";
+
+	out << "  \"counters\": {";
+	for (size_t k = 0; k < counters.size(); ++k)
+		out << (k ? ",\n" : "\n") << "    " << jsonString(counters[k].first) << ": " << counters[k].second;
+	out << "\n  },\n";
+
+	out << "  \"cluster_sizes\": [";
+	for (size_t k = 0; k < clusterSizes.size(); ++k)
+		out << (k ? ", " : "") << "{\"size\": " << clusterSizes[k].first << ", \"clusters\": " << clusterSizes[k].second << "}";
+	out << "],\n";
+
+	out << "  \"sample_every\": " << sampleEvery << ",\n"
+	    << "  \"samples\": [";
+	for (size_t k = 0; k < samples.size(); ++k) {
+		out << (k ? ",\n" : "\n")
+		    << "    {\"a\": " << jsonString(samples[k].a) << ", \"b\": " << jsonString(samples[k].b)
+		    << ", \"outcome\": \"" << outcomeName(samples[k].outcome) << "\""
+		    << ", \"ns\": " << samples[k].nanoseconds << "}";
+	}
+	out << (samples.empty() ? "]\n" : "\n  ]\n") << "}\n";
+
+	out.close();
+	return (bool)out;
+}
+
+StageTimer::StageTimer(RunMetrics *metrics, const char *name)
+	: metrics(metrics), name(name), start(chrono::steady_clock::now()), startCpu(metrics ? processCpuSeconds() : 0) {
+}
+
+StageTimer::~StageTimer() {
+	if (metrics)
+		metrics->addStage(name, secondsSince(start), processCpuSeconds() - startCpu);
+}
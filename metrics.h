@@ -0,0 +1,80 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "cluster.h"
+#include "glyphstore.h"
+
+// What a run measured: wall and CPU time of every stage, counters, the
+// cluster size histogram and, in sampling mode, traced pairs. Written as one
+// JSON object by --metrics.
+class RunMetrics {
+public:
+	// Starts the clock of the whole run
+	RunMetrics();
+
+	// Adds value to counter name, created at zero on first use
+	void count(const std::string &name, unsigned long long value);
+
+	void addStage(const std::string &name, double wallSeconds, double cpuSeconds);
+
+	// Counters of partitionParallel and the like, and their samples
+	void addPartitionStats(const GlyphStore &store, const PartitionStats &stats);
+
+	// The number of clusters and how many there are of every size
+	void addClusters(const std::vector<std::vector<int>> &clusters);
+
+	bool write(const boost::filesystem::path &file) const;
+
+	// Stored as text, e.g. the method or the distance kernel
+	std::vector<std::pair<std::string, std::string>> settings;
+
+	// PartitionStats::sampleEvery of the clustering stages
+	unsigned sampleEvery = 0;
+
+private:
+	struct Stage {
+		std::string name;
+		double      wallSeconds, cpuSeconds;
+	};
+
+	struct Sample {
+		std::string a, b;
+		PairOutcome outcome;
+		float       nanoseconds;
+	};
+
+	std::chrono::steady_clock::time_point start;
+	double startCpu;
+
+	std::vector<Stage>                                      stages;
+	std::vector<std::pair<std::string, unsigned long long>> counters;
+	std::vector<std::pair<size_t, size_t>>                  clusterSizes;   // size, clusters
+	std::vector<Sample>                                     samples;
+};
+
+// CPU time of all threads of the process so far, in seconds
+double processCpuSeconds();
+
+// Adds the wall and CPU time between construction and destruction to
+// metrics as a stage, unless metrics is null. CPU time is that of the whole
+// process, so stages running several threads show more CPU than wall time.
+class StageTimer {
+public:
+	StageTimer(RunMetrics *metrics, const char *name);
+	~StageTimer();
+
+private:
+	RunMetrics *metrics;
+	const char *name;
+	std::chrono::steady_clock::time_point start;
+	double startCpu;
+};
+
+#endif // METRICS_H
@@ -0,0 +1,219 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <opencv2/highgui/highgui.hpp>
+
+#include "preprocess.h"
+#include "queue.h"
+
+namespace fs = boost::filesystem;
+
+using namespace std;
+using namespace cv;
+
+
+void cropImage(Mat &img, Mat &res, Point &massCentre) {
+
+	massCentre = Point(0, 0);
+	int weightsSum = 0;
+	bool rowEmpty;
+	int fstRow = img.rows, lastRow = -1;
+	int fstCol = img.cols, lastCol = -1;
+
+	for (int y = 0; y < img.rows; ++y) {
+		rowEmpty = true;
+		for (int x = 0; x < img.cols; ++x) {
+			uchar val = img.at<uchar>(y, x);
+
+			if (val != 255) {
+				fstCol   = min( fstCol, x);
+				lastCol  = max(lastCol, x);
+				rowEmpty = false;
+				massCentre += Point(x, y) * (255 - val);
+				weightsSum += (255 - val);
+			}
+		}
+
+		if (!rowEmpty) {
+			fstRow  = min( fstRow, y);
+			lastRow = max(lastRow, y);
+		}
+	}
+
+	massCentre = Point((float)massCentre.x / weightsSum - fstCol, (float)massCentre.y / weightsSum - fstRow);
+	res = img(Rect(fstCol, fstRow, lastCol - fstCol + 1, lastRow - fstRow + 1));
+}
+
+namespace {
+
+// A file on its way through openImages; its glyph is filled in by a worker
+// unless it came from the cache
+struct PendingGlyph {
+	fs::path  file;
+	uintmax_t fileSize;
+	time_t    fileTime;
+	Mat       glyph;
+	Point     massCentre;
+};
+
+// openImages over the files source(visit) hands to visit
+template <typename Source>
+size_t openFiles(Source source, GlyphStore &store, int workers, const GlyphCache *cache, RunMetrics *metrics) {
+
+	StageTimer timer(metrics, "open");
+	cerr << "> Opening and preprocessing images:" << endl;
+	GlyphStore().swap(store);
+
+	auto start = chrono::steady_clock::now();
+	mutex logLock;
+	BoundedQueue<PendingGlyph> files(64 * workers);
+	BoundedQueue<PendingGlyph> results(64 * workers);
+	atomic<size_t> reused(0), decoded(0), failed(0);
+	atomic<unsigned long long> bytesRead(0);
+
+	// The enumerator and every worker feed results; the last one closes it
+	atomic<int> running(workers + 1);
+
+	thread enumerator([&] {
+		source([&](const fs::path &file) {
+
+			PendingGlyph pending;
+			pending.file = file;
+			if (!pending.file.has_extension() || pending.file.extension().string() != ".png") {
+				lock_guard<mutex> guard(logLock);
+				cerr << "Skipping file: \"" << pending.file.string() << "\"" << endl;
+				return;
+			}
+
+			boost::system::error_code sizeError, timeError;
+			pending.fileSize = fs::file_size(pending.file, sizeError);
+			pending.fileTime = fs::last_write_time(pending.file, timeError);
+
+			if (cache && !sizeError && !timeError && cache->find(pending.file.filename().string(),
+					pending.fileSize, pending.fileTime, pending.glyph, pending.massCentre)) {
+				++reused;
+				results.push(move(pending));
+				return;
+			}
+
+			files.push(move(pending));
+		});
+		files.close();
+
+		if (--running == 0)
+			results.close();
+	});
+
+	vector<thread> decoders;
+	for (int w = 0; w < workers; ++w) {
+		decoders.emplace_back([&] {
+			PendingGlyph pending;
+			while (files.pop(pending)) {
+
+				Mat tmp = imread(pending.file.string(), CV_LOAD_IMAGE_GRAYSCALE);
+				bytesRead += pending.fileSize;
+				if (tmp.empty()) {
+					++failed;
+					lock_guard<mutex> guard(logLock);
+					cerr << "Could not load file \"" << pending.file.string() << "\"" << endl;
+					continue;
+				}
+
+				cropImage(tmp, pending.glyph, pending.massCentre);
+				++decoded;
+				results.push(move(pending));
+			}
+
+			if (--running == 0)
+				results.close();
+		});
+	}
+
+	PendingGlyph pending;
+	while (results.pop(pending)) {
+		store.add(pending.glyph, pending.massCentre, pending.file.filename().string(), pending.fileSize, pending.fileTime);
+		if (store.size() % 250 == 0) {
+			lock_guard<mutex> guard(logLock);
+			cerr << "\r" << store.size();
+		}
+	}
+
+	enumerator.join();
+	for (thread &t : decoders)
+		t.join();
+
+	store.sortByName();
+
+	double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	cerr << "\rOpened " << store.size() << " images in " << seconds << " s ("
+	     << (seconds > 0 ? store.size() / seconds : 0) << " files/s, " << workers << " workers)" << endl;
+	cerr << "Glyph store: " << store.arenaSize() / 1024 << " KiB of pixels" << endl;
+	if (cache)
+		cerr << "Reused " << reused << " of " << cache->size() << " cached glyphs" << endl;
+
+	if (metrics) {
+		metrics->count("images",          store.size());
+		metrics->count("images_decoded",  decoded);
+		metrics->count("images_reused",   reused);
+		metrics->count("decode_failures", failed);
+		metrics->count("bytes_read",      bytesRead);
+		metrics->count("arena_bytes",     store.arenaSize());
+	}
+
+	return reused;
+}
+
+} // namespace
+
+size_t openImages(const fs::path &path, GlyphStore &store, int workers, const GlyphCache *cache, RunMetrics *metrics) {
+	return openFiles([&](auto visit) {
+		for (fs::directory_iterator it(path), eod; it != eod; ++it)
+			visit(fs::absolute(*it));
+	}, store, workers, cache, metrics);
+}
+
+size_t openImages(const fs::path &dir, const vector<string> &names, GlyphStore &store, int workers,
+                  const GlyphCache *cache, RunMetrics *metrics) {
+	const fs::path absolute = fs::absolute(dir);
+	return openFiles([&](auto visit) {
+		for (const string &name : names)
+			visit(absolute / name);
+	}, store, workers, cache, metrics);
+}
+
+vector<string> listImages(const fs::path &dir) {
+	vector<string> names;
+	for (fs::directory_iterator it(dir), eod; it != eod; ++it) {
+		const fs::path &file = it->path();
+		if (file.has_extension() && file.extension().string() == ".png")
+			names.push_back(file.filename().string());
+	}
+	sort(names.begin(), names.end());
+	return names;
+}
+
+// FNV-1a over every name with its terminating zero, size and mtime
+uint64_t hashImages(const fs::path &dir, const vector<string> &names) {
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	auto mix = [&](const void *data, size_t size) {
+		for (size_t k = 0; k < size; ++k) {
+			hash ^= static_cast<const unsigned char *>(data)[k];
+			hash *= 0x100000001b3ULL;
+		}
+	};
+
+	for (const string &name : names) {
+		boost::system::error_code sizeError, timeError;
+		const uint64_t size = fs::file_size(dir / name, sizeError);
+		const int64_t  time = fs::last_write_time(dir / name, timeError);
+		mix(name.c_str(), name.size() + 1);
+		mix(&size, sizeof(size));
+		mix(&time, sizeof(time));
+	}
+	return hash;
+}
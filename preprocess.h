@@ -0,0 +1,42 @@
+#ifndef PREPROCESS_H
+#define PREPROCESS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <opencv2/core/core.hpp>
+
+#include "glyphcache.h"
+#include "glyphstore.h"
+#include "metrics.h"
+
+// Crops img to the bounding box of its non-white pixels; res shares img's
+// pixels. massCentre is the centre of the ink (255 - value), within res.
+void cropImage(cv::Mat &img, cv::Mat &res, cv::Point &massCentre);
+
+// Three stage pipeline: a helper thread enumerates the directory, a pool
+// of workers decodes and crops, and the calling thread copies the glyphs
+// into the store, letting go of the decoded images. They are sorted by file
+// name at the end, so the order depends neither on the file system nor on
+// scheduling. Files that have an up to date copy in the cache are taken from
+// there and skip decoding. Returns how many were. Counts the images decoded
+// and the bytes read into metrics, unless that is null.
+size_t openImages(const boost::filesystem::path &path, GlyphStore &store, int workers, const GlyphCache *cache,
+                  RunMetrics *metrics = nullptr);
+
+// Same, but only for the given files of dir.
+size_t openImages(const boost::filesystem::path &dir, const std::vector<std::string> &names, GlyphStore &store,
+                  int workers, const GlyphCache *cache, RunMetrics *metrics = nullptr);
+
+// Names of the *.png files openImages(dir, ...) would open, sorted like the
+// store it fills. Does not read the files.
+std::vector<std::string> listImages(const boost::filesystem::path &dir);
+
+// Hash of the names and of the size and modification time of those files of
+// dir; changes when an image is added, removed or replaced.
+uint64_t hashImages(const boost::filesystem::path &dir, const std::vector<std::string> &names);
+
+#endif // PREPROCESS_H
@@ -0,0 +1,161 @@
+#include <cstring>
+#include <map>
+
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <boost/filesystem/fstream.hpp>
+
+#include "binaryio.h"
+#include "shards.h"
+
+namespace fs = boost::filesystem;
+
+using namespace std;
+
+
+namespace {
+
+const char shardMagic[8] = { 'G', 'L', 'Y', 'P', 'H', 'S', 'H', '2' };
+
+// Starts program with args, its output going to log; -1 if that failed
+pid_t spawn(const string &program, const vector<string> &args, const fs::path &log) {
+	vector<char *> argv;
+	argv.push_back(const_cast<char *>(program.c_str()));
+	for (const string &arg : args)
+		argv.push_back(const_cast<char *>(arg.c_str()));
+	argv.push_back(nullptr);
+
+	pid_t pid = fork();
+	if (pid == 0) {
+		int fd = open(log.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (fd >= 0) {
+			dup2(fd, STDOUT_FILENO);
+			dup2(fd, STDERR_FILENO);
+			close(fd);
+		}
+		execv(program.c_str(), argv.data());
+		_exit(127);
+	}
+	return pid;
+}
+
+} // namespace
+
+
+void ShardPlan::blocksOf(int shard, int &a, int &b) const {
+	a = 0;
+	while (shard >= blocks - a) {
+		shard -= blocks - a;
+		++a;
+	}
+	b = a + shard;
+}
+
+fs::path shardFile(const fs::path &dir, int shard) {
+	return dir / ("shard-" + to_string(shard) + ".bin");
+}
+
+// Layout: magic, image count, blocks, shard, images hash, threshold, failed
+// count and edge count, then the failed images and the edges.
+bool saveShard(const fs::path &file, const ShardPlan &plan, int shard, uint64_t imagesHash, const ShardResult &result) {
+
+	return replaceFile(file, [&](ostream &out) {
+		out.write(shardMagic, sizeof(shardMagic));
+		writeValue(out, (uint32_t)plan.images);
+		writeValue(out, (uint32_t)plan.blocks);
+		writeValue(out, (uint32_t)shard);
+		writeValue(out, imagesHash);
+		writeValue(out, plan.threshold);
+		writeValue(out, (uint32_t)result.failed.size());
+		writeValue(out, (uint32_t)result.edges.size());
+
+		for (int image : result.failed)
+			writeValue(out, (uint32_t)image);
+		for (const pair<int, int> &edge : result.edges) {
+			writeValue(out, (uint32_t)edge.first);
+			writeValue(out, (uint32_t)edge.second);
+		}
+	});
+}
+
+bool loadShard(const fs::path &file, const ShardPlan &plan, int shard, uint64_t imagesHash, ShardResult &result) {
+
+	fs::ifstream in(file, ios::binary);
+	char magic[sizeof(shardMagic)];
+	uint32_t images, blocks, index, failed, edges;
+	uint64_t hash;
+	float threshold;
+
+	if (!in.read(magic, sizeof(magic)) || memcmp(magic, shardMagic, sizeof(magic)) != 0
+			|| !readValue(in, images) || !readValue(in, blocks) || !readValue(in, index)
+			|| !readValue(in, hash) || !readValue(in, threshold)
+			|| !readValue(in, failed) || !readValue(in, edges))
+		return false;
+
+	if (images != (uint32_t)plan.images || blocks != (uint32_t)plan.blocks || index != (uint32_t)shard
+			|| hash != imagesHash || threshold != plan.threshold || failed > images || edges > images)
+		return false;
+
+	result.failed.assign(failed, 0);
+	for (int &image : result.failed) {
+		uint32_t value;
+		if (!readValue(in, value) || value >= images)
+			return false;
+		image = value;
+	}
+
+	result.edges.assign(edges, make_pair(0, 0));
+	for (pair<int, int> &edge : result.edges) {
+		uint32_t a, b;
+		if (!readValue(in, a) || !readValue(in, b) || a >= images || b >= images)
+			return false;
+		edge = make_pair((int)a, (int)b);
+	}
+
+	return true;
+}
+
+vector<int> runShardProcesses(const string &program, const vector<string> &args, const string &lastArg,
+                              const vector<int> &shards, int processes, const fs::path &logDir) {
+
+	map<pid_t, int> running;
+	vector<int> failed;
+	size_t next = 0;
+
+	while (next < shards.size() || !running.empty()) {
+		while (next < shards.size() && (int)running.size() < processes) {
+			const int shard = shards[next++];
+			vector<string> shardArgs(args);
+			shardArgs.push_back("--shard");
+			shardArgs.push_back(to_string(shard));
+			shardArgs.push_back(lastArg);
+
+			pid_t pid = spawn(program, shardArgs, logDir / ("shard-" + to_string(shard) + ".log"));
+			if (pid < 0)
+				failed.push_back(shard);
+			else
+				running[pid] = shard;
+		}
+
+		if (running.empty())
+			continue;
+
+		int status;
+		pid_t pid = wait(&status);
+		if (pid < 0) {
+			for (const auto &child : running)
+				failed.push_back(child.second);
+			break;
+		}
+		auto it = running.find(pid);
+		if (it == running.end())
+			continue;
+		if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+			failed.push_back(it->second);
+		running.erase(it);
+	}
+
+	return failed;
+}
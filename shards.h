@@ -0,0 +1,56 @@
+#ifndef SHARDS_H
+#define SHARDS_H
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+// The pairs of images sorted by name, cut into shards for separate
+// processes: the images are split into blocks of consecutive ones, and a
+// shard covers the pairs within one block or between two of them.
+struct ShardPlan {
+	ShardPlan(int images, int blocks, float threshold) : images(images), blocks(blocks), threshold(threshold) { }
+
+	int shards() const { return blocks * (blocks + 1) / 2; }
+
+	// Blocks a <= b of shard, numbered row by row: (0, 0), (0, 1), ...
+	void blocksOf(int shard, int &a, int &b) const;
+
+	// First image of block, or the number of images for block == blocks
+	int blockBegin(int block) const { return (int)((long long)images * block / blocks); }
+
+	int   images;
+	int   blocks;
+	float threshold;
+};
+
+// What a shard found, as indices into the sorted names of all images: those
+// it could not load, and a spanning forest of the glyphs it joined.
+struct ShardResult {
+	std::vector<int>                 failed;
+	std::vector<std::pair<int, int>> edges;
+};
+
+// "shard-<shard>.bin" in dir
+boost::filesystem::path shardFile(const boost::filesystem::path &dir, int shard);
+
+// Written to a temporary file first, so a crashed shard leaves nothing behind.
+bool saveShard(const boost::filesystem::path &file, const ShardPlan &plan, int shard, uint64_t imagesHash,
+               const ShardResult &result);
+
+// False if the file is missing, damaged, or made for another plan, shard or
+// hashImages of the input directory.
+bool loadShard(const boost::filesystem::path &file, const ShardPlan &plan, int shard, uint64_t imagesHash,
+               ShardResult &result);
+
+// Runs "program args... --shard <k> lastArg" for every listed shard, at most
+// processes at once, with the output of each going to shard-<k>.log in
+// logDir. Returns the shards whose process failed.
+std::vector<int> runShardProcesses(const std::string &program, const std::vector<std::string> &args,
+                                   const std::string &lastArg, const std::vector<int> &shards, int processes,
+                                   const boost::filesystem::path &logDir);
+
+#endif // SHARDS_H
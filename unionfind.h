@@ -0,0 +1,79 @@
+#ifndef UNIONFIND_H
+#define UNIONFIND_H
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+
+// Lock-free disjoint sets over 0..n-1. Roots are only ever linked under a
+// smaller index, so concurrent unions cannot create cycles; find compresses
+// paths by halving with a CAS that may fail harmlessly.
+class ConcurrentUnionFind {
+public:
+	explicit ConcurrentUnionFind(int n) : size(n), parent(new std::atomic<int>[n]) {
+		for (int i = 0; i < n; ++i)
+			parent[i].store(i, std::memory_order_relaxed);
+	}
+
+	int find(int x) {
+		while (true) {
+			int p = parent[x].load(std::memory_order_acquire);
+			if (p == x)
+				return x;
+			int gp = parent[p].load(std::memory_order_acquire);
+			if (p != gp)
+				parent[x].compare_exchange_weak(p, gp, std::memory_order_release, std::memory_order_relaxed);
+			x = gp;
+		}
+	}
+
+	bool same(int a, int b) {
+		while (true) {
+			a = find(a);
+			b = find(b);
+			if (a == b)
+				return true;
+			// a may have been linked meanwhile, in which case look again
+			if (parent[a].load(std::memory_order_acquire) == a)
+				return false;
+		}
+	}
+
+	// Returns false if a and b were already in one set
+	bool unite(int a, int b) {
+		while (true) {
+			a = find(a);
+			b = find(b);
+			if (a == b)
+				return false;
+			if (a < b)
+				std::swap(a, b);
+			int expected = a;
+			if (parent[a].compare_exchange_strong(expected, b, std::memory_order_acq_rel))
+				return true;
+		}
+	}
+
+	// Numbers the sets in order of their first element, like cv::partition
+	// does, and returns how many there are. Not thread-safe.
+	int components(std::vector<int> &labels) {
+		labels.assign(size, -1);
+		std::vector<int> setOf(size, -1);
+		int number = 0;
+		for (int i = 0; i < size; ++i) {
+			int root = find(i);
+			if (setOf[root] < 0)
+				setOf[root] = number++;
+			labels[i] = setOf[root];
+		}
+		return number;
+	}
+
+private:
+	int size;
+	std::unique_ptr<std::atomic<int>[]> parent;
+};
+
+#endif // UNIONFIND_H